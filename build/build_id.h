@@ -0,0 +1 @@
+#define HULK_BUILD_ID "b6b07615ef22ab72"
@@ -0,0 +1,2501 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "src/frontend/parser/parser.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "ast/ast.h"
+#include "common/common.h"
+#include "common/intern.h"
+#include "hulk_type/type_table.h"
+
+#line 82 "build/parser.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_NUMBER = 3,                     /* NUMBER  */
+  YYSYMBOL_BOOLEAN = 4,                    /* BOOLEAN  */
+  YYSYMBOL_STRING = 5,                     /* STRING  */
+  YYSYMBOL_ID = 6,                         /* ID  */
+  YYSYMBOL_COMP = 7,                       /* COMP  */
+  YYSYMBOL_ADD = 8,                        /* ADD  */
+  YYSYMBOL_SUB = 9,                        /* SUB  */
+  YYSYMBOL_MUL = 10,                       /* MUL  */
+  YYSYMBOL_DIV = 11,                       /* DIV  */
+  YYSYMBOL_MOD = 12,                       /* MOD  */
+  YYSYMBOL_POW = 13,                       /* POW  */
+  YYSYMBOL_CONCAT = 14,                    /* CONCAT  */
+  YYSYMBOL_DCONCAT = 15,                   /* DCONCAT  */
+  YYSYMBOL_AND = 16,                       /* AND  */
+  YYSYMBOL_OR = 17,                        /* OR  */
+  YYSYMBOL_NOT = 18,                       /* NOT  */
+  YYSYMBOL_SEMICOLON = 19,                 /* SEMICOLON  */
+  YYSYMBOL_COLON = 20,                     /* COLON  */
+  YYSYMBOL_COMMA = 21,                     /* COMMA  */
+  YYSYMBOL_LPAREN = 22,                    /* LPAREN  */
+  YYSYMBOL_RPAREN = 23,                    /* RPAREN  */
+  YYSYMBOL_LBRACKET = 24,                  /* LBRACKET  */
+  YYSYMBOL_RBRACKET = 25,                  /* RBRACKET  */
+  YYSYMBOL_DOT = 26,                       /* DOT  */
+  YYSYMBOL_IF = 27,                        /* IF  */
+  YYSYMBOL_ELIF = 28,                      /* ELIF  */
+  YYSYMBOL_ELSE = 29,                      /* ELSE  */
+  YYSYMBOL_WHILE = 30,                     /* WHILE  */
+  YYSYMBOL_LET = 31,                       /* LET  */
+  YYSYMBOL_IN = 32,                        /* IN  */
+  YYSYMBOL_NEW = 33,                       /* NEW  */
+  YYSYMBOL_ASSIGN = 34,                    /* ASSIGN  */
+  YYSYMBOL_REASSIGN = 35,                  /* REASSIGN  */
+  YYSYMBOL_FUNCTION = 36,                  /* FUNCTION  */
+  YYSYMBOL_ARROW = 37,                     /* ARROW  */
+  YYSYMBOL_TYPE = 38,                      /* TYPE  */
+  YYSYMBOL_INHERITS = 39,                  /* INHERITS  */
+  YYSYMBOL_IFX = 40,                       /* IFX  */
+  YYSYMBOL_YYACCEPT = 41,                  /* $accept  */
+  YYSYMBOL_Program = 42,                   /* Program  */
+  YYSYMBOL_FunctionDefList = 43,           /* FunctionDefList  */
+  YYSYMBOL_FunctionDefinition = 44,        /* FunctionDefinition  */
+  YYSYMBOL_FunctionHeader = 45,            /* FunctionHeader  */
+  YYSYMBOL_OptionalType = 46,              /* OptionalType  */
+  YYSYMBOL_ParameterList = 47,             /* ParameterList  */
+  YYSYMBOL_Parameter = 48,                 /* Parameter  */
+  YYSYMBOL_FunctionBody = 49,              /* FunctionBody  */
+  YYSYMBOL_TypeDefinitionList = 50,        /* TypeDefinitionList  */
+  YYSYMBOL_TypeDefinition = 51,            /* TypeDefinition  */
+  YYSYMBOL_TypeDefinitionHeader = 52,      /* TypeDefinitionHeader  */
+  YYSYMBOL_OptionalTypeParams = 53,        /* OptionalTypeParams  */
+  YYSYMBOL_OptionalInherits = 54,          /* OptionalInherits  */
+  YYSYMBOL_OptionalParentArgs = 55,        /* OptionalParentArgs  */
+  YYSYMBOL_TypeDefinitionBody = 56,        /* TypeDefinitionBody  */
+  YYSYMBOL_TypeExprList = 57,              /* TypeExprList  */
+  YYSYMBOL_TypeDefExpr = 58,               /* TypeDefExpr  */
+  YYSYMBOL_Expression = 59,                /* Expression  */
+  YYSYMBOL_IfExpr = 60,                    /* IfExpr  */
+  YYSYMBOL_Else_Elif_Branch = 61,          /* Else_Elif_Branch  */
+  YYSYMBOL_WhileLoopExpr = 62,             /* WhileLoopExpr  */
+  YYSYMBOL_LetInExpr = 63,                 /* LetInExpr  */
+  YYSYMBOL_VariableAssigmentList = 64,     /* VariableAssigmentList  */
+  YYSYMBOL_VariableAssigment = 65,         /* VariableAssigment  */
+  YYSYMBOL_OrExpr = 66,                    /* OrExpr  */
+  YYSYMBOL_AndExpr = 67,                   /* AndExpr  */
+  YYSYMBOL_CompExpr = 68,                  /* CompExpr  */
+  YYSYMBOL_AddExpr = 69,                   /* AddExpr  */
+  YYSYMBOL_MultExpr = 70,                  /* MultExpr  */
+  YYSYMBOL_PowExpr = 71,                   /* PowExpr  */
+  YYSYMBOL_T = 72,                         /* T  */
+  YYSYMBOL_ArgList = 73,                   /* ArgList  */
+  YYSYMBOL_OptionalArgList = 74,           /* OptionalArgList  */
+  YYSYMBOL_ExprBlock = 75,                 /* ExprBlock  */
+  YYSYMBOL_ExpressionList = 76,            /* ExpressionList  */
+  YYSYMBOL_OptionalExpressionList = 77,    /* OptionalExpressionList  */
+  YYSYMBOL_OptionalEnd = 78                /* OptionalEnd  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+/* Unqualified %code blocks.  */
+#line 25 "src/frontend/parser/parser.y"
+
+// Scanner reentrante generado por flex (lexer.l)
+int yylex(YYSTYPE* yylval_param, void* yyscanner);
+char* yyget_text(void* yyscanner);
+void yyerror(void* scanner, CompilationContext* ctx, const char *s);
+
+// Agrega un elemento a una lista temporal duplicando la capacidad cuando se
+// llena, de modo que construir una lista de n elementos cuesta O(n)
+#define LIST_PUSH(items, count, capacity, item) do {                          \
+        if ((count) == (capacity)) {                                          \
+            (capacity) = (capacity) ? (capacity) * 2 : 4;                     \
+            (items) = realloc((items), (size_t)(capacity) * sizeof(*(items))); \
+            if (!(items)) DIE("Out of memory in parser list");                \
+        }                                                                     \
+        (items)[(count)++] = (item);                                          \
+    } while (0)
+
+static void param_list_push(ParamList* list, char* name, char* type) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 4;
+        list->names = realloc(list->names, (size_t)list->capacity * sizeof(char*));
+        list->types = realloc(list->types, (size_t)list->capacity * sizeof(char*));
+        if (!list->names || !list->types) DIE("Out of memory in ParameterList");
+    }
+    list->names[list->count] = name;
+    list->types[list->count] = type;
+    list->count++;
+}
+
+static void param_list_free(ParamList* list) {
+    free(list->names);
+    free(list->types);
+}
+
+// Invierte una lista temporal en el sitio
+static void reverse_list(void** items, int count) {
+    for (int i = 0, j = count - 1; i < j; i++, j--) {
+        void* tmp = items[i];
+        items[i] = items[j];
+        items[j] = tmp;
+    }
+}
+
+#line 239 "build/parser.tab.c"
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   150
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  41
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  38
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  83
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  151
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   295
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   141,   141,   159,   164,   167,   180,   188,   189,   193,
+     196,   201,   208,   211,   212,   216,   221,   228,   237,   247,
+     248,   251,   252,   254,   255,   258,   264,   265,   272,   273,
+     276,   277,   278,   279,   282,   289,   292,   296,   302,   308,
+     315,   322,   329,   336,   337,   340,   341,   344,   345,   348,
+     349,   350,   351,   352,   355,   356,   357,   358,   361,   362,
+     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
+     379,   384,   390,   397,   402,   405,   406,   413,   419,   424,
+     427,   428,   435,   436
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "NUMBER", "BOOLEAN",
+  "STRING", "ID", "COMP", "ADD", "SUB", "MUL", "DIV", "MOD", "POW",
+  "CONCAT", "DCONCAT", "AND", "OR", "NOT", "SEMICOLON", "COLON", "COMMA",
+  "LPAREN", "RPAREN", "LBRACKET", "RBRACKET", "DOT", "IF", "ELIF", "ELSE",
+  "WHILE", "LET", "IN", "NEW", "ASSIGN", "REASSIGN", "FUNCTION", "ARROW",
+  "TYPE", "INHERITS", "IFX", "$accept", "Program", "FunctionDefList",
+  "FunctionDefinition", "FunctionHeader", "OptionalType", "ParameterList",
+  "Parameter", "FunctionBody", "TypeDefinitionList", "TypeDefinition",
+  "TypeDefinitionHeader", "OptionalTypeParams", "OptionalInherits",
+  "OptionalParentArgs", "TypeDefinitionBody", "TypeExprList",
+  "TypeDefExpr", "Expression", "IfExpr", "Else_Elif_Branch",
+  "WhileLoopExpr", "LetInExpr", "VariableAssigmentList",
+  "VariableAssigment", "OrExpr", "AndExpr", "CompExpr", "AddExpr",
+  "MultExpr", "PowExpr", "T", "ArgList", "OptionalArgList", "ExprBlock",
+  "ExpressionList", "OptionalExpressionList", "OptionalEnd", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-86)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-83)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
+{
+     -86,    18,    10,   -86,    15,    44,     8,   -86,   -13,   -86,
+     -86,   -86,    -7,     1,     1,    80,    35,    45,    51,    58,
+      70,    81,   -86,    67,    73,   -86,   -86,   -86,    76,    78,
+      88,    30,    25,   -86,     3,   -86,    58,    80,   -86,    73,
+      77,    80,    75,    75,    82,    74,    80,    80,    80,    83,
+      72,   -12,   -86,    86,    87,   -86,   -86,   -86,   -86,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+     106,    19,   -86,    95,   -86,    92,    80,   -86,   -86,   -86,
+      97,    94,    96,   112,   -86,    80,    58,    80,    77,    58,
+      85,     2,    78,    88,    30,    25,    25,    25,    25,   -86,
+     -86,   -86,   -86,    98,    58,    83,   -86,   -86,   100,   101,
+     -86,    80,    80,   -86,   -86,   -86,   -86,    99,    42,   119,
+     -86,    68,   -86,   -86,   -86,   108,    77,   -86,   -86,   -86,
+      23,   -86,   -86,   -86,   107,   -86,   109,   113,    80,   -86,
+      77,   -86,   -86,    80,   -86,   111,   114,   -86,    80,    23,
+     -86
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       4,     0,    15,     1,     0,     0,     0,     3,     0,    60,
+      61,    62,    67,     0,     0,     0,    80,     0,     0,     0,
+       0,     0,    16,     0,    83,    31,    32,    33,    30,    44,
+      46,    48,    53,    57,    59,    66,     9,     0,     5,    83,
+      75,     0,    65,    64,     0,     0,     0,     0,     0,     7,
+       0,     0,    40,     0,    19,    26,    17,    82,     2,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    10,     0,    14,     0,     0,    68,    63,    77,
+      83,     0,     0,     0,    12,     0,     0,     0,    75,     9,
+      22,     0,    43,    45,    47,    49,    50,    51,    52,    54,
+      55,    56,    58,    72,     0,     7,    13,    69,    73,    81,
+      78,     0,     0,     8,    42,    41,    39,     0,     0,     0,
+      18,     7,    25,    28,    27,     0,    75,    11,     6,    76,
+      35,    38,    70,    20,    23,    29,     0,     0,     0,    34,
+      75,    21,    71,     0,    37,     0,     0,    24,     0,    35,
+      36
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+     -86,   -86,   -86,    39,   -86,    26,    47,   -35,   -86,   -86,
+     -86,   -86,   -86,   -86,   -86,   -86,   -86,   -86,   -15,   -86,
+     -11,   -86,   -86,   -86,   -74,   -86,    84,    79,    89,    -6,
+      12,     0,   -85,   -86,   132,   -86,   -86,   -37
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     1,     2,     7,     8,    84,    71,    50,    38,     5,
+      22,    23,    90,   120,   141,    56,    91,   124,    24,    25,
+     139,    26,    27,    51,    52,    28,    29,    30,    31,    32,
+      33,    34,    75,    76,    35,    45,    46,    58
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      44,    72,    74,   117,     9,    10,    11,    12,   121,    86,
+      13,    16,   115,    42,    43,    40,    69,   125,     3,    14,
+      87,     6,    73,    15,    37,    16,    77,   122,    41,    70,
+      36,    80,    81,    82,    20,    66,    67,    68,    62,    63,
+     104,   136,   105,   110,    64,    65,     4,     9,    10,    11,
+      12,   137,   138,    13,    72,   145,    95,    96,    97,    98,
+     -79,   108,    14,   104,    49,   133,    15,    47,    16,   127,
+     114,    17,   116,    48,    18,    19,    53,    20,    99,   100,
+     101,   102,    21,     9,    10,    11,    12,    54,    83,    13,
+      36,    55,    57,    59,    60,    61,   130,   131,    14,    79,
+     -74,    70,    15,    83,    16,    78,    85,    17,    88,    89,
+      18,    19,   103,    20,   106,   107,   109,   111,   113,   112,
+     126,   129,   132,   144,   119,   134,   -82,   135,   146,   140,
+     123,   128,   142,   149,   147,   143,   118,   148,   150,    93,
+      39,     0,     0,    92,     0,     0,     0,     0,     0,     0,
+      94
+};
+
+static const yytype_int16 yycheck[] =
+{
+      15,    36,    39,    88,     3,     4,     5,     6,     6,    21,
+       9,    24,    86,    13,    14,    22,    13,    91,     0,    18,
+      32,     6,    37,    22,    37,    24,    41,    25,    35,    26,
+      22,    46,    47,    48,    33,    10,    11,    12,     8,     9,
+      21,   126,    23,    80,    14,    15,    36,     3,     4,     5,
+       6,    28,    29,     9,    89,   140,    62,    63,    64,    65,
+      25,    76,    18,    21,     6,    23,    22,    22,    24,   104,
+      85,    27,    87,    22,    30,    31,     6,    33,    66,    67,
+      68,    69,    38,     3,     4,     5,     6,     6,    20,     9,
+      22,    24,    19,    17,    16,     7,   111,   112,    18,    25,
+      23,    26,    22,    20,    24,    23,    34,    27,    22,    22,
+      30,    31,     6,    33,    19,    23,    19,    23,     6,    23,
+      22,    21,    23,   138,    39,     6,    25,    19,   143,    22,
+      91,   105,    23,   148,    23,    22,    89,    23,   149,    60,
+       8,    -1,    -1,    59,    -1,    -1,    -1,    -1,    -1,    -1,
+      61
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    42,    43,     0,    36,    50,     6,    44,    45,     3,
+       4,     5,     6,     9,    18,    22,    24,    27,    30,    31,
+      33,    38,    51,    52,    59,    60,    62,    63,    66,    67,
+      68,    69,    70,    71,    72,    75,    22,    37,    49,    75,
+      22,    35,    72,    72,    59,    76,    77,    22,    22,     6,
+      48,    64,    65,     6,     6,    24,    56,    19,    78,    17,
+      16,     7,     8,     9,    14,    15,    10,    11,    12,    13,
+      26,    47,    48,    59,    78,    73,    74,    59,    23,    25,
+      59,    59,    59,    20,    46,    34,    21,    32,    22,    22,
+      53,    57,    67,    68,    69,    70,    70,    70,    70,    71,
+      71,    71,    71,     6,    21,    23,    19,    23,    59,    19,
+      78,    23,    23,     6,    59,    65,    59,    73,    47,    39,
+      54,     6,    25,    44,    58,    65,    22,    48,    46,    21,
+      59,    59,    23,    23,     6,    19,    73,    28,    29,    61,
+      22,    55,    23,    22,    59,    73,    59,    23,    23,    59,
+      61
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    41,    42,    43,    43,    44,    45,    46,    46,    47,
+      47,    47,    48,    49,    49,    50,    50,    51,    52,    53,
+      53,    54,    54,    55,    55,    56,    57,    57,    58,    58,
+      59,    59,    59,    59,    60,    61,    61,    61,    62,    63,
+      64,    64,    65,    66,    66,    67,    67,    68,    68,    69,
+      69,    69,    69,    69,    70,    70,    70,    70,    71,    71,
+      72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
+      72,    72,    72,    73,    73,    74,    74,    75,    76,    76,
+      77,    77,    78,    78
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     4,     3,     0,     2,     5,     0,     2,     0,
+       1,     3,     2,     3,     2,     0,     2,     2,     4,     0,
+       3,     3,     0,     0,     3,     3,     0,     2,     1,     2,
+       1,     1,     1,     1,     6,     0,     6,     2,     5,     4,
+       1,     3,     3,     3,     1,     3,     1,     3,     1,     3,
+       3,     3,     3,     1,     3,     3,     3,     1,     3,     1,
+       1,     1,     1,     3,     2,     2,     1,     1,     3,     4,
+       5,     6,     3,     2,     0,     0,     3,     3,     3,     0,
+       0,     3,     1,     0
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (scanner, ctx, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, scanner, ctx); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void* scanner, CompilationContext* ctx)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (scanner);
+  YY_USE (ctx);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void* scanner, CompilationContext* ctx)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, ctx);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, void* scanner, CompilationContext* ctx)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, ctx);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, ctx); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, void* scanner, CompilationContext* ctx)
+{
+  YY_USE (yyvaluep);
+  YY_USE (scanner);
+  YY_USE (ctx);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  switch (yykind)
+    {
+    case YYSYMBOL_FunctionDefList: /* FunctionDefList  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).function_def_list).nodes); }
+#line 1312 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_FunctionHeader: /* FunctionHeader  */
+#line 126 "src/frontend/parser/parser.y"
+            { param_list_free(&((*yyvaluep).function_header).params); }
+#line 1318 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_ParameterList: /* ParameterList  */
+#line 125 "src/frontend/parser/parser.y"
+            { param_list_free(&((*yyvaluep).param_list_info)); }
+#line 1324 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_TypeDefinitionList: /* TypeDefinitionList  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).type_def_list).nodes); }
+#line 1330 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_TypeDefinitionHeader: /* TypeDefinitionHeader  */
+#line 127 "src/frontend/parser/parser.y"
+            { param_list_free(&((*yyvaluep).type_def_header).params); free(((*yyvaluep).type_def_header).parent_args); }
+#line 1336 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_OptionalTypeParams: /* OptionalTypeParams  */
+#line 125 "src/frontend/parser/parser.y"
+            { param_list_free(&((*yyvaluep).param_list_info)); }
+#line 1342 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_OptionalInherits: /* OptionalInherits  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).inherit_info).nodes); }
+#line 1348 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_OptionalParentArgs: /* OptionalParentArgs  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).node_list).nodes); }
+#line 1354 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_TypeExprList: /* TypeExprList  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).node_list).nodes); }
+#line 1360 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_VariableAssigmentList: /* VariableAssigmentList  */
+#line 124 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).var_assig_node_list).list); }
+#line 1366 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_ArgList: /* ArgList  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).node_list).nodes); }
+#line 1372 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_OptionalArgList: /* OptionalArgList  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).node_list).nodes); }
+#line 1378 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_ExpressionList: /* ExpressionList  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).node_list).nodes); }
+#line 1384 "build/parser.tab.c"
+        break;
+
+    case YYSYMBOL_OptionalExpressionList: /* OptionalExpressionList  */
+#line 123 "src/frontend/parser/parser.y"
+            { free(((*yyvaluep).node_list).nodes); }
+#line 1390 "build/parser.tab.c"
+        break;
+
+      default:
+        break;
+    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void* scanner, CompilationContext* ctx)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, scanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* Program: FunctionDefList TypeDefinitionList Expression OptionalEnd  */
+#line 142 "src/frontend/parser/parser.y"
+                        {
+                            // Las listas se recogen en orden de la fuente (recursion por la
+                            // izquierda, pila acotada) y se invierten para conservar el orden
+                            // que el resto del compilador recibia de la antigua regla
+                            // recursiva por la derecha: la ultima definicion primero.
+                            reverse_list((void**)(yyvsp[-3].function_def_list).nodes, (yyvsp[-3].function_def_list).count);
+                            reverse_list((void**)(yyvsp[-2].type_def_list).nodes, (yyvsp[-2].type_def_list).count);
+                            ctx->root_node = create_program_node(
+                                create_function_definition_list_node((yyvsp[-3].function_def_list).nodes, (yyvsp[-3].function_def_list).count, ctx), 
+                                create_type_definition_list_node((yyvsp[-2].type_def_list).nodes, (yyvsp[-2].type_def_list).count, ctx),
+                                (yyvsp[-1].node), 
+                                ctx); 
+                            free((yyvsp[-3].function_def_list).nodes);
+                            free((yyvsp[-2].type_def_list).nodes);
+                        }
+#line 1683 "build/parser.tab.c"
+    break;
+
+  case 3: /* FunctionDefList: FunctionDefList FUNCTION FunctionDefinition  */
+#line 160 "src/frontend/parser/parser.y"
+                        { 
+                            (yyval.function_def_list) = (yyvsp[-2].function_def_list);
+                            LIST_PUSH((yyval.function_def_list).nodes, (yyval.function_def_list).count, (yyval.function_def_list).capacity, (FunctionDefinitionNode*)(yyvsp[0].node));
+                        }
+#line 1692 "build/parser.tab.c"
+    break;
+
+  case 4: /* FunctionDefList: %empty  */
+#line 164 "src/frontend/parser/parser.y"
+                                         { (yyval.function_def_list).nodes = NULL; (yyval.function_def_list).count = 0; (yyval.function_def_list).capacity = 0; }
+#line 1698 "build/parser.tab.c"
+    break;
+
+  case 5: /* FunctionDefinition: FunctionHeader FunctionBody  */
+#line 168 "src/frontend/parser/parser.y"
+                        { (yyval.node) = create_function_definition_node(
+                          (yyvsp[-1].function_header).name,
+                          (yyvsp[-1].function_header).params.names,
+                          (yyvsp[-1].function_header).params.types,
+                          (yyvsp[-1].function_header).params.count,
+                          (yyvsp[-1].function_header).return_type,
+                          (yyvsp[0].node),
+                          ctx);
+                          param_list_free(&(yyvsp[-1].function_header).params);
+                        }
+#line 1713 "build/parser.tab.c"
+    break;
+
+  case 6: /* FunctionHeader: ID LPAREN ParameterList RPAREN OptionalType  */
+#line 181 "src/frontend/parser/parser.y"
+                        {
+                           (yyval.function_header).name = (yyvsp[-4].sval);
+                           (yyval.function_header).params = (yyvsp[-2].param_list_info);
+                           (yyval.function_header).return_type = (yyvsp[0].sval);
+                        }
+#line 1723 "build/parser.tab.c"
+    break;
+
+  case 7: /* OptionalType: %empty  */
+#line 188 "src/frontend/parser/parser.y"
+                                                            {(yyval.sval) = interned_names()->undefined;}
+#line 1729 "build/parser.tab.c"
+    break;
+
+  case 8: /* OptionalType: COLON ID  */
+#line 189 "src/frontend/parser/parser.y"
+                                                            {(yyval.sval) = (yyvsp[0].sval);}
+#line 1735 "build/parser.tab.c"
+    break;
+
+  case 9: /* ParameterList: %empty  */
+#line 193 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.param_list_info) = (ParamList){ NULL, NULL, 0, 0 };
+                        }
+#line 1743 "build/parser.tab.c"
+    break;
+
+  case 10: /* ParameterList: Parameter  */
+#line 197 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.param_list_info) = (ParamList){ NULL, NULL, 0, 0 };
+                            param_list_push(&(yyval.param_list_info), (yyvsp[0].param_info).name, (yyvsp[0].param_info).type);
+                        }
+#line 1752 "build/parser.tab.c"
+    break;
+
+  case 11: /* ParameterList: ParameterList COMMA Parameter  */
+#line 202 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.param_list_info) = (yyvsp[-2].param_list_info);
+                            param_list_push(&(yyval.param_list_info), (yyvsp[0].param_info).name, (yyvsp[0].param_info).type);
+                        }
+#line 1761 "build/parser.tab.c"
+    break;
+
+  case 12: /* Parameter: ID OptionalType  */
+#line 208 "src/frontend/parser/parser.y"
+                                                             { (yyval.param_info).name = (yyvsp[-1].sval);   (yyval.param_info).type = (yyvsp[0].sval); }
+#line 1767 "build/parser.tab.c"
+    break;
+
+  case 13: /* FunctionBody: ARROW Expression SEMICOLON  */
+#line 211 "src/frontend/parser/parser.y"
+                                                             { (yyval.node) = (yyvsp[-1].node);}
+#line 1773 "build/parser.tab.c"
+    break;
+
+  case 14: /* FunctionBody: ExprBlock OptionalEnd  */
+#line 212 "src/frontend/parser/parser.y"
+                                                             { (yyval.node) = (yyvsp[-1].node); }
+#line 1779 "build/parser.tab.c"
+    break;
+
+  case 15: /* TypeDefinitionList: %empty  */
+#line 216 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.type_def_list).nodes = NULL;
+                            (yyval.type_def_list).count = 0;
+                            (yyval.type_def_list).capacity = 0;
+                        }
+#line 1789 "build/parser.tab.c"
+    break;
+
+  case 16: /* TypeDefinitionList: TypeDefinitionList TypeDefinition  */
+#line 222 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.type_def_list) = (yyvsp[-1].type_def_list);
+                            LIST_PUSH((yyval.type_def_list).nodes, (yyval.type_def_list).count, (yyval.type_def_list).capacity, (TypeDefinitionNode*)(yyvsp[0].node));
+                        }
+#line 1798 "build/parser.tab.c"
+    break;
+
+  case 17: /* TypeDefinition: TypeDefinitionHeader TypeDefinitionBody  */
+#line 229 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_type_definition_node((yyvsp[-1].type_def_header).name, (yyvsp[-1].type_def_header).params.names, (yyvsp[-1].type_def_header).params.types, (yyvsp[-1].type_def_header).params.count, (yyvsp[-1].type_def_header).parent_name, 
+                            (yyvsp[-1].type_def_header).parent_args, (yyvsp[-1].type_def_header).parent_args_count, (yyvsp[0].node), ctx);
+                            param_list_free(&(yyvsp[-1].type_def_header).params);
+                            free((yyvsp[-1].type_def_header).parent_args);
+                        }
+#line 1809 "build/parser.tab.c"
+    break;
+
+  case 18: /* TypeDefinitionHeader: TYPE ID OptionalTypeParams OptionalInherits  */
+#line 238 "src/frontend/parser/parser.y"
+                        {
+                          (yyval.type_def_header).name = (yyvsp[-2].sval);
+                          (yyval.type_def_header).params = (yyvsp[-1].param_list_info);
+                          (yyval.type_def_header).parent_name = (yyvsp[0].inherit_info).name;
+                          (yyval.type_def_header).parent_args = (yyvsp[0].inherit_info).nodes;
+                          (yyval.type_def_header).parent_args_count = (yyvsp[0].inherit_info).count;
+                        }
+#line 1821 "build/parser.tab.c"
+    break;
+
+  case 19: /* OptionalTypeParams: %empty  */
+#line 247 "src/frontend/parser/parser.y"
+                                                        {(yyval.param_list_info) = (ParamList){ NULL, NULL, 0, 0 }; }
+#line 1827 "build/parser.tab.c"
+    break;
+
+  case 20: /* OptionalTypeParams: LPAREN ParameterList RPAREN  */
+#line 248 "src/frontend/parser/parser.y"
+                                                        {(yyval.param_list_info) = (yyvsp[-1].param_list_info);}
+#line 1833 "build/parser.tab.c"
+    break;
+
+  case 21: /* OptionalInherits: INHERITS ID OptionalParentArgs  */
+#line 251 "src/frontend/parser/parser.y"
+                                                         {(yyval.inherit_info).name = (yyvsp[-1].sval); (yyval.inherit_info).nodes = (yyvsp[0].node_list).nodes; (yyval.inherit_info).count = (yyvsp[0].node_list).count;}
+#line 1839 "build/parser.tab.c"
+    break;
+
+  case 22: /* OptionalInherits: %empty  */
+#line 252 "src/frontend/parser/parser.y"
+                                                         {(yyval.inherit_info).name = interned_names()->object; (yyval.inherit_info).nodes = NULL; (yyval.inherit_info).count = 0;}
+#line 1845 "build/parser.tab.c"
+    break;
+
+  case 23: /* OptionalParentArgs: %empty  */
+#line 254 "src/frontend/parser/parser.y"
+                                                         {(yyval.node_list).nodes = NULL; (yyval.node_list).count = 0; (yyval.node_list).capacity = 0;}
+#line 1851 "build/parser.tab.c"
+    break;
+
+  case 24: /* OptionalParentArgs: LPAREN ArgList RPAREN  */
+#line 255 "src/frontend/parser/parser.y"
+                                                         {(yyval.node_list) = (yyvsp[-1].node_list);}
+#line 1857 "build/parser.tab.c"
+    break;
+
+  case 25: /* TypeDefinitionBody: LBRACKET TypeExprList RBRACKET  */
+#line 259 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_expression_block_node((yyvsp[-1].node_list).nodes, (yyvsp[-1].node_list).count, ctx);
+                            free((yyvsp[-1].node_list).nodes);
+                        }
+#line 1866 "build/parser.tab.c"
+    break;
+
+  case 26: /* TypeExprList: %empty  */
+#line 264 "src/frontend/parser/parser.y"
+                                                         { (yyval.node_list).nodes = NULL; (yyval.node_list).count = 0; (yyval.node_list).capacity = 0; }
+#line 1872 "build/parser.tab.c"
+    break;
+
+  case 27: /* TypeExprList: TypeExprList TypeDefExpr  */
+#line 266 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node_list) = (yyvsp[-1].node_list);
+                            LIST_PUSH((yyval.node_list).nodes, (yyval.node_list).count, (yyval.node_list).capacity, (yyvsp[0].node));
+                        }
+#line 1881 "build/parser.tab.c"
+    break;
+
+  case 28: /* TypeDefExpr: FunctionDefinition  */
+#line 272 "src/frontend/parser/parser.y"
+                                                          {(yyval.node) = (yyvsp[0].node);}
+#line 1887 "build/parser.tab.c"
+    break;
+
+  case 29: /* TypeDefExpr: VariableAssigment SEMICOLON  */
+#line 273 "src/frontend/parser/parser.y"
+                                                          {(yyval.node) = (ASTNode*)(yyvsp[-1].var_assig_node);}
+#line 1893 "build/parser.tab.c"
+    break;
+
+  case 30: /* Expression: OrExpr  */
+#line 276 "src/frontend/parser/parser.y"
+                                  {(yyval.node) = (yyvsp[0].node);}
+#line 1899 "build/parser.tab.c"
+    break;
+
+  case 31: /* Expression: IfExpr  */
+#line 277 "src/frontend/parser/parser.y"
+                                  {(yyval.node) = (yyvsp[0].node);}
+#line 1905 "build/parser.tab.c"
+    break;
+
+  case 32: /* Expression: WhileLoopExpr  */
+#line 278 "src/frontend/parser/parser.y"
+                                        {(yyval.node) = (yyvsp[0].node);}
+#line 1911 "build/parser.tab.c"
+    break;
+
+  case 33: /* Expression: LetInExpr  */
+#line 279 "src/frontend/parser/parser.y"
+                                    {(yyval.node) = (yyvsp[0].node);}
+#line 1917 "build/parser.tab.c"
+    break;
+
+  case 34: /* IfExpr: IF LPAREN Expression RPAREN Expression Else_Elif_Branch  */
+#line 283 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_conditional_node((yyvsp[-3].node), (yyvsp[-1].node), (yyvsp[0].node), ctx);
+                        }
+#line 1925 "build/parser.tab.c"
+    break;
+
+  case 35: /* Else_Elif_Branch: %empty  */
+#line 289 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = NULL; // No else or elif branches
+                        }
+#line 1933 "build/parser.tab.c"
+    break;
+
+  case 36: /* Else_Elif_Branch: ELIF LPAREN Expression RPAREN Expression Else_Elif_Branch  */
+#line 293 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_conditional_node((yyvsp[-3].node), (yyvsp[-1].node), (yyvsp[0].node), ctx);
+                        }
+#line 1941 "build/parser.tab.c"
+    break;
+
+  case 37: /* Else_Elif_Branch: ELSE Expression  */
+#line 297 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = (yyvsp[0].node);
+                        }
+#line 1949 "build/parser.tab.c"
+    break;
+
+  case 38: /* WhileLoopExpr: WHILE LPAREN Expression RPAREN Expression  */
+#line 303 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_while_loop_node((yyvsp[-2].node), (yyvsp[0].node), ctx);
+                        }
+#line 1957 "build/parser.tab.c"
+    break;
+
+  case 39: /* LetInExpr: LET VariableAssigmentList IN Expression  */
+#line 309 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_let_in_node((yyvsp[-2].var_assig_node_list).list, (yyvsp[-2].var_assig_node_list).count, (yyvsp[0].node), ctx);
+                            free((yyvsp[-2].var_assig_node_list).list);
+                        }
+#line 1966 "build/parser.tab.c"
+    break;
+
+  case 40: /* VariableAssigmentList: VariableAssigment  */
+#line 316 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.var_assig_node_list).list = NULL;
+                            (yyval.var_assig_node_list).count = 0;
+                            (yyval.var_assig_node_list).capacity = 0;
+                            LIST_PUSH((yyval.var_assig_node_list).list, (yyval.var_assig_node_list).count, (yyval.var_assig_node_list).capacity, (yyvsp[0].var_assig_node));
+                        }
+#line 1977 "build/parser.tab.c"
+    break;
+
+  case 41: /* VariableAssigmentList: VariableAssigmentList COMMA VariableAssigment  */
+#line 323 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.var_assig_node_list) = (yyvsp[-2].var_assig_node_list);
+                            LIST_PUSH((yyval.var_assig_node_list).list, (yyval.var_assig_node_list).count, (yyval.var_assig_node_list).capacity, (yyvsp[0].var_assig_node));
+                        }
+#line 1986 "build/parser.tab.c"
+    break;
+
+  case 42: /* VariableAssigment: Parameter ASSIGN Expression  */
+#line 330 "src/frontend/parser/parser.y"
+                        { 
+                            VariableAssigment* var = create_variable_assigment((yyvsp[-2].param_info).name, (yyvsp[-2].param_info).type, (yyvsp[0].node), ctx);
+                            (yyval.var_assig_node) = (VariableAssigmentNode*)create_variable_assigment_node(var, ctx);
+                        }
+#line 1995 "build/parser.tab.c"
+    break;
+
+  case 43: /* OrExpr: OrExpr OR AndExpr  */
+#line 336 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(OR_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2001 "build/parser.tab.c"
+    break;
+
+  case 44: /* OrExpr: AndExpr  */
+#line 337 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[0].node); }
+#line 2007 "build/parser.tab.c"
+    break;
+
+  case 45: /* AndExpr: AndExpr AND CompExpr  */
+#line 340 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(AND_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2013 "build/parser.tab.c"
+    break;
+
+  case 46: /* AndExpr: CompExpr  */
+#line 341 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[0].node); }
+#line 2019 "build/parser.tab.c"
+    break;
+
+  case 47: /* CompExpr: CompExpr COMP AddExpr  */
+#line 344 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node((yyvsp[-1].token), (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2025 "build/parser.tab.c"
+    break;
+
+  case 48: /* CompExpr: AddExpr  */
+#line 345 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[0].node); }
+#line 2031 "build/parser.tab.c"
+    break;
+
+  case 49: /* AddExpr: AddExpr ADD MultExpr  */
+#line 348 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(PLUS_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx ); }
+#line 2037 "build/parser.tab.c"
+    break;
+
+  case 50: /* AddExpr: AddExpr SUB MultExpr  */
+#line 349 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(MINUS_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2043 "build/parser.tab.c"
+    break;
+
+  case 51: /* AddExpr: AddExpr CONCAT MultExpr  */
+#line 350 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(CONCAT_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2049 "build/parser.tab.c"
+    break;
+
+  case 52: /* AddExpr: AddExpr DCONCAT MultExpr  */
+#line 351 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(D_CONCAT_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2055 "build/parser.tab.c"
+    break;
+
+  case 53: /* AddExpr: MultExpr  */
+#line 352 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[0].node); }
+#line 2061 "build/parser.tab.c"
+    break;
+
+  case 54: /* MultExpr: MultExpr MUL PowExpr  */
+#line 355 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(MULT_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2067 "build/parser.tab.c"
+    break;
+
+  case 55: /* MultExpr: MultExpr DIV PowExpr  */
+#line 356 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(DIV_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx ); }
+#line 2073 "build/parser.tab.c"
+    break;
+
+  case 56: /* MultExpr: MultExpr MOD PowExpr  */
+#line 357 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(MOD_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2079 "build/parser.tab.c"
+    break;
+
+  case 57: /* MultExpr: PowExpr  */
+#line 358 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[0].node); }
+#line 2085 "build/parser.tab.c"
+    break;
+
+  case 58: /* PowExpr: T POW PowExpr  */
+#line 361 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_binary_operation_node(EXP_TK, (yyvsp[-2].node), (yyvsp[0].node), ctx); }
+#line 2091 "build/parser.tab.c"
+    break;
+
+  case 59: /* PowExpr: T  */
+#line 362 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[0].node); }
+#line 2097 "build/parser.tab.c"
+    break;
+
+  case 60: /* T: NUMBER  */
+#line 365 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_number_literal_node((yyvsp[0].dval) , ctx); }
+#line 2103 "build/parser.tab.c"
+    break;
+
+  case 61: /* T: BOOLEAN  */
+#line 366 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_bool_literal_node((yyvsp[0].ival), ctx); }
+#line 2109 "build/parser.tab.c"
+    break;
+
+  case 62: /* T: STRING  */
+#line 367 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_string_literal_node((yyvsp[0].sval), ctx); }
+#line 2115 "build/parser.tab.c"
+    break;
+
+  case 63: /* T: LPAREN Expression RPAREN  */
+#line 368 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[-1].node); }
+#line 2121 "build/parser.tab.c"
+    break;
+
+  case 64: /* T: NOT T  */
+#line 369 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_unary_operation_node(NOT_TK, (yyvsp[0].node), ctx); }
+#line 2127 "build/parser.tab.c"
+    break;
+
+  case 65: /* T: SUB T  */
+#line 370 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_unary_operation_node(MINUS_TK, (yyvsp[0].node), ctx); }
+#line 2133 "build/parser.tab.c"
+    break;
+
+  case 66: /* T: ExprBlock  */
+#line 371 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = (yyvsp[0].node); }
+#line 2139 "build/parser.tab.c"
+    break;
+
+  case 67: /* T: ID  */
+#line 372 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_variable_node((yyvsp[0].sval), ctx); }
+#line 2145 "build/parser.tab.c"
+    break;
+
+  case 68: /* T: ID REASSIGN Expression  */
+#line 373 "src/frontend/parser/parser.y"
+                                                    { (yyval.node) = create_reassign_node((yyvsp[-2].sval), (yyvsp[0].node), ctx);}
+#line 2151 "build/parser.tab.c"
+    break;
+
+  case 69: /* T: ID LPAREN ArgList RPAREN  */
+#line 375 "src/frontend/parser/parser.y"
+                        { 
+                            (yyval.node) = create_function_call_node((yyvsp[-3].sval), (yyvsp[-1].node_list).nodes, (yyvsp[-1].node_list).count, ctx);
+                            free((yyvsp[-1].node_list).nodes);
+                        }
+#line 2160 "build/parser.tab.c"
+    break;
+
+  case 70: /* T: NEW ID LPAREN ArgList RPAREN  */
+#line 380 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_new_node((yyvsp[-3].sval), (yyvsp[-1].node_list).nodes, (yyvsp[-1].node_list).count, ctx);
+                            free((yyvsp[-1].node_list).nodes);
+                        }
+#line 2169 "build/parser.tab.c"
+    break;
+
+  case 71: /* T: T DOT ID LPAREN ArgList RPAREN  */
+#line 385 "src/frontend/parser/parser.y"
+                        {
+                            // Método: objeto.metodo(args)
+                            (yyval.node) = create_attribute_access_node((yyvsp[-5].node), (yyvsp[-3].sval), (yyvsp[-1].node_list).nodes, (yyvsp[-1].node_list).count, true, ctx);
+                            free((yyvsp[-1].node_list).nodes);
+                        }
+#line 2179 "build/parser.tab.c"
+    break;
+
+  case 72: /* T: T DOT ID  */
+#line 391 "src/frontend/parser/parser.y"
+                        {
+                            // Atributo: objeto.atributo
+                            (yyval.node) = create_attribute_access_node((yyvsp[-2].node), (yyvsp[0].sval), NULL, 0, false, ctx);
+                        }
+#line 2188 "build/parser.tab.c"
+    break;
+
+  case 73: /* ArgList: OptionalArgList Expression  */
+#line 398 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node_list) = (yyvsp[-1].node_list);
+                            LIST_PUSH((yyval.node_list).nodes, (yyval.node_list).count, (yyval.node_list).capacity, (yyvsp[0].node));
+                        }
+#line 2197 "build/parser.tab.c"
+    break;
+
+  case 74: /* ArgList: %empty  */
+#line 402 "src/frontend/parser/parser.y"
+                                                    { (yyval.node_list).nodes = NULL; (yyval.node_list).count = 0; (yyval.node_list).capacity = 0; }
+#line 2203 "build/parser.tab.c"
+    break;
+
+  case 75: /* OptionalArgList: %empty  */
+#line 405 "src/frontend/parser/parser.y"
+                                                    { (yyval.node_list).nodes = NULL; (yyval.node_list).count = 0; (yyval.node_list).capacity = 0; }
+#line 2209 "build/parser.tab.c"
+    break;
+
+  case 76: /* OptionalArgList: OptionalArgList Expression COMMA  */
+#line 407 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node_list) = (yyvsp[-2].node_list);
+                            LIST_PUSH((yyval.node_list).nodes, (yyval.node_list).count, (yyval.node_list).capacity, (yyvsp[-1].node));
+                        }
+#line 2218 "build/parser.tab.c"
+    break;
+
+  case 77: /* ExprBlock: LBRACKET ExpressionList RBRACKET  */
+#line 414 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node) = create_expression_block_node((yyvsp[-1].node_list).nodes, (yyvsp[-1].node_list).count, ctx);
+                            free((yyvsp[-1].node_list).nodes);
+                        }
+#line 2227 "build/parser.tab.c"
+    break;
+
+  case 78: /* ExpressionList: OptionalExpressionList Expression OptionalEnd  */
+#line 420 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node_list) = (yyvsp[-2].node_list);
+                            LIST_PUSH((yyval.node_list).nodes, (yyval.node_list).count, (yyval.node_list).capacity, (yyvsp[-1].node));
+                        }
+#line 2236 "build/parser.tab.c"
+    break;
+
+  case 79: /* ExpressionList: %empty  */
+#line 424 "src/frontend/parser/parser.y"
+                                                    { (yyval.node_list).nodes = NULL; (yyval.node_list).count = 0; (yyval.node_list).capacity = 0; }
+#line 2242 "build/parser.tab.c"
+    break;
+
+  case 80: /* OptionalExpressionList: %empty  */
+#line 427 "src/frontend/parser/parser.y"
+                                                     { (yyval.node_list).nodes = NULL; (yyval.node_list).count = 0; (yyval.node_list).capacity = 0; }
+#line 2248 "build/parser.tab.c"
+    break;
+
+  case 81: /* OptionalExpressionList: OptionalExpressionList Expression SEMICOLON  */
+#line 429 "src/frontend/parser/parser.y"
+                        {
+                            (yyval.node_list) = (yyvsp[-2].node_list);
+                            LIST_PUSH((yyval.node_list).nodes, (yyval.node_list).count, (yyval.node_list).capacity, (yyvsp[-1].node));
+                        }
+#line 2257 "build/parser.tab.c"
+    break;
+
+
+#line 2261 "build/parser.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (scanner, ctx, yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, scanner, ctx);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, ctx);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (scanner, ctx, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, scanner, ctx);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, ctx);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 438 "src/frontend/parser/parser.y"
+
+
+void yyerror(void* scanner, CompilationContext* ctx, const char *s) {
+    fprintf(stderr, "%s\n", s);
+    fprintf(stderr, "  (at line %u):", ctx->loc.line);
+
+    // Linea fuente hasta el token donde fallo el parseo
+    const char* text = yyget_text(scanner);
+    size_t length = 0;
+    const char* line = source_file_line(&ctx->source, ctx->loc.line, &length);
+    size_t upto = line ? ctx->loc.column - 1 + (text ? strlen(text) : 0) : 0;
+    fprintf(stderr, "\"%.*s... ,\"", (int)(upto < length ? upto : length), line ? line : "");
+
+    if (text && *text != '\0') {
+        fprintf(stderr, " near '%s'\n", text);
+    }
+}
@@ -0,0 +1,152 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_BUILD_PARSER_TAB_H_INCLUDED
+# define YY_YY_BUILD_PARSER_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 12 "src/frontend/parser/parser.y"
+
+#include "common/context.h"
+
+// Listas que el parser construye antes de crear el nodo (los constructores del
+// AST copian los elementos a la arena y la lista temporal se libera)
+typedef struct ParamList {
+    char** names;
+    char** types;
+    int count;
+    int capacity;
+} ParamList;
+
+#line 62 "build/parser.tab.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    NUMBER = 258,                  /* NUMBER  */
+    BOOLEAN = 259,                 /* BOOLEAN  */
+    STRING = 260,                  /* STRING  */
+    ID = 261,                      /* ID  */
+    COMP = 262,                    /* COMP  */
+    ADD = 263,                     /* ADD  */
+    SUB = 264,                     /* SUB  */
+    MUL = 265,                     /* MUL  */
+    DIV = 266,                     /* DIV  */
+    MOD = 267,                     /* MOD  */
+    POW = 268,                     /* POW  */
+    CONCAT = 269,                  /* CONCAT  */
+    DCONCAT = 270,                 /* DCONCAT  */
+    AND = 271,                     /* AND  */
+    OR = 272,                      /* OR  */
+    NOT = 273,                     /* NOT  */
+    SEMICOLON = 274,               /* SEMICOLON  */
+    COLON = 275,                   /* COLON  */
+    COMMA = 276,                   /* COMMA  */
+    LPAREN = 277,                  /* LPAREN  */
+    RPAREN = 278,                  /* RPAREN  */
+    LBRACKET = 279,                /* LBRACKET  */
+    RBRACKET = 280,                /* RBRACKET  */
+    DOT = 281,                     /* DOT  */
+    IF = 282,                      /* IF  */
+    ELIF = 283,                    /* ELIF  */
+    ELSE = 284,                    /* ELSE  */
+    WHILE = 285,                   /* WHILE  */
+    LET = 286,                     /* LET  */
+    IN = 287,                      /* IN  */
+    NEW = 288,                     /* NEW  */
+    ASSIGN = 289,                  /* ASSIGN  */
+    REASSIGN = 290,                /* REASSIGN  */
+    FUNCTION = 291,                /* FUNCTION  */
+    ARROW = 292,                   /* ARROW  */
+    TYPE = 293,                    /* TYPE  */
+    INHERITS = 294,                /* INHERITS  */
+    IFX = 295                      /* IFX  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 75 "src/frontend/parser/parser.y"
+
+    double dval;
+    int ival;
+    char* sval;
+    HULK_Op token;
+    struct ASTNode* node;
+    struct { struct ASTNode** nodes;  int count; int capacity;} node_list;
+    struct VariableAssigmentNode* var_assig_node;
+    struct { struct VariableAssigmentNode** list; int count; int capacity; } var_assig_node_list;
+    struct { char* name; char* type;} param_info;
+    ParamList param_list_info;
+    struct { char* name; ParamList params; char* return_type;} function_header;
+    struct { char* name; ParamList params;
+             char* parent_name; struct ASTNode** parent_args; int parent_args_count;} type_def_header;
+    struct { char* name; struct ASTNode** nodes; int count ;} inherit_info;
+    struct { FunctionDefinitionNode** nodes; int count; int capacity;} function_def_list;
+    struct { TypeDefinitionNode** nodes; int count; int capacity;} type_def_list;
+
+
+#line 139 "build/parser.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int yyparse (void* scanner, CompilationContext* ctx);
+
+
+#endif /* !YY_YY_BUILD_PARSER_TAB_H_INCLUDED  */
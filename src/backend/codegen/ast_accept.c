@@ -1,13 +1,14 @@
 
 #include "../frontend/ast/ast.h" // Incluye las definiciones de nodos y NodeType
 #include "llvm/generator.h" // Incluye la definicion de LLVMCodeGenerator
+#include "log.h"
 
 LLVMValueRef generic_ast_accept(struct ASTNode* self, struct LLVMCodeGenerator* visitor) {
     if (!self || !visitor) {
         fprintf(stderr, "Error critico: ASTNode o Visitor nulo en accept.\n");
         return NULL;
     }
-    printf("[generic_ast_accept] self->type: %d\n", self->type);
+    LOG_TRACE(LOG_CAT_CODEGEN, "[generic_ast_accept] self->type: %d\n", self->type);
     // Usamos el campo 'type' para saber que tipo de nodo concreto es 'self'
     // y llamar al metodo 'visit_' correspondiente del visitor.
     switch (self->type) {
@@ -29,7 +30,7 @@ LLVMValueRef generic_ast_accept(struct ASTNode* self, struct LLVMCodeGenerator*
 
         
         case AST_Node_Expression_Block:
-            printf("[generic_ast_accept] AST_Node_Expression_Block\n");
+            LOG_TRACE(LOG_CAT_CODEGEN, "[generic_ast_accept] AST_Node_Expression_Block\n");
              if (visitor->visit_ExpressionBlock)
                 return visitor->visit_ExpressionBlock(visitor, (ExpressionBlockNode*)self);
             break;    
@@ -41,7 +42,7 @@ LLVMValueRef generic_ast_accept(struct ASTNode* self, struct LLVMCodeGenerator*
             break;
         
         case AST_Node_While_Loop:
-            printf("[generic_ast_accept] AST_Node_While_Loop\n");
+            LOG_TRACE(LOG_CAT_CODEGEN, "[generic_ast_accept] AST_Node_While_Loop\n");
              if (visitor->visit_WhileLoop)
                 return visitor->visit_WhileLoop(visitor, (WhileLoopNode*)self);
             break;
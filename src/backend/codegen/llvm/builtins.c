@@ -2,10 +2,12 @@
 #include "../../../frontend/ast/ast.h"
 #include "utils.h"
 #include "generator.h"
+#include "log.h"
+#include "../ast_accept.h"
 
 LLVMValueRef emit_builtin_print(LLVMCodeGenerator* self, FunctionCallNode* node) {
     LLVMValueRef printf_func = LLVMGetNamedFunction(self->module, "printf");
-    LLVMValueRef arg = node->arg_count > 0 ? node->args[0]->accept(node->args[0], self) : NULL;
+    LLVMValueRef arg = node->arg_count > 0 ? generic_ast_accept(node->args[0], self) : NULL;
     LLVMValueRef fmt;
     LLVMValueRef args[2];
     int num_args = 1;
@@ -37,7 +39,7 @@ LLVMValueRef emit_builtin_print(LLVMCodeGenerator* self, FunctionCallNode* node)
 }
 
 LLVMValueRef generate_builtin_function(LLVMCodeGenerator* self, FunctionCallNode* node) {
-    printf("generate_builtin_function: name = %s\n", node->name);
+    LOG_TRACE(LOG_CAT_CODEGEN, "generate_builtin_function: name = %s\n", node->name);
     switch (get_builtin_kind(node->name)) {
         case BUILTIN_PRINT:
             return emit_builtin_print(self, node);
@@ -46,7 +48,7 @@ LLVMValueRef generate_builtin_function(LLVMCodeGenerator* self, FunctionCallNode
         case BUILTIN_COS:
         case BUILTIN_EXP:
         case BUILTIN_LOG: {
-            LLVMValueRef arg = node->arg_count > 0 ? node->args[0]->accept(node->args[0], self) : NULL;
+            LLVMValueRef arg = node->arg_count > 0 ? generic_ast_accept(node->args[0], self) : NULL;
             LLVMValueRef fn = LLVMGetNamedFunction(self->module, node->name);
             LLVMTypeRef fn_type = LLVMFunctionType(LLVMDoubleTypeInContext(self->context),
                 (LLVMTypeRef[]){LLVMDoubleTypeInContext(self->context)}, 1, 0);
@@ -55,8 +57,8 @@ LLVMValueRef generate_builtin_function(LLVMCodeGenerator* self, FunctionCallNode
         case BUILTIN_POW:
         case BUILTIN_FMOD: {
             if (node->arg_count < 2) return NULL;
-            LLVMValueRef arg1 = node->args[0]->accept(node->args[0], self);
-            LLVMValueRef arg2 = node->args[1]->accept(node->args[1], self);
+            LLVMValueRef arg1 = generic_ast_accept(node->args[0], self);
+            LLVMValueRef arg2 = generic_ast_accept(node->args[1], self);
             LLVMValueRef fn = LLVMGetNamedFunction(self->module, node->name);
             LLVMTypeRef fn_type = LLVMFunctionType(LLVMDoubleTypeInContext(self->context),
                 (LLVMTypeRef[]){LLVMDoubleTypeInContext(self->context), LLVMDoubleTypeInContext(self->context)}, 2, 0);
@@ -0,0 +1,147 @@
+#include "emitter.h"
+#include <llvm-c/BitWriter.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+static bool emit_native(LLVMModuleRef module, LLVMTargetMachineRef target_machine, LLVMCodeGenFileType type, const char* output_path) {
+    if (!target_machine) {
+        fprintf(stderr, "Error: no hay TargetMachine para emitir codigo nativo.\n");
+        return false;
+    }
+    char* error = NULL;
+    if (LLVMTargetMachineEmitToFile(target_machine, module, (char*)output_path, type, &error) != 0) {
+        fprintf(stderr, "Error al emitir '%s': %s\n", output_path, error);
+        LLVMDisposeMessage(error);
+        return false;
+    }
+    return true;
+}
+
+static bool link_executable(const char* object_path, const char* output_path) {
+    // El enlace lo hace el driver del sistema (crt0, libc y libm); se puede cambiar con HULK_LINKER
+    const char* linker = getenv("HULK_LINKER");
+    if (!linker || !*linker) linker = "cc";
+
+    char* const argv[] = { (char*)linker, (char*)object_path, "-o", (char*)output_path, "-lm", NULL };
+    pid_t pid;
+    if (posix_spawnp(&pid, linker, NULL, NULL, argv, environ) != 0) {
+        fprintf(stderr, "Error: no se pudo ejecutar el enlazador '%s'.\n", linker);
+        return false;
+    }
+    int status = 0;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "Error: el enlace de '%s' fallo.\n", output_path);
+        return false;
+    }
+    return true;
+}
+
+static bool emit_executable(LLVMModuleRef module, LLVMTargetMachineRef target_machine, const char* output_path) {
+    const char* tmpdir = getenv("TMPDIR");
+    char object_path[4096];
+    snprintf(object_path, sizeof(object_path), "%s/hulk-XXXXXX.o", tmpdir && *tmpdir ? tmpdir : "/tmp");
+
+    int fd = mkstemps(object_path, 2);
+    if (fd < 0) {
+        perror("No se pudo crear el objeto temporal");
+        return false;
+    }
+    close(fd);
+
+    bool ok = emit_native(module, target_machine, LLVMObjectFile, object_path)
+           && link_executable(object_path, output_path);
+    unlink(object_path);
+    return ok;
+}
+
+bool emit_module(LLVMModuleRef module, LLVMTargetMachineRef target_machine, EmitKind kind, const char* output_path) {
+    if (!module || !output_path) return false;
+
+    switch (kind) {
+        case EMIT_LLVM: {
+            char* error = NULL;
+            if (LLVMPrintModuleToFile(module, output_path, &error) != 0) {
+                fprintf(stderr, "Error al escribir el modulo LLVM: %s\n", error);
+                LLVMDisposeMessage(error);
+                return false;
+            }
+            return true;
+        }
+        case EMIT_BITCODE:
+            if (LLVMWriteBitcodeToFile(module, output_path) != 0) {
+                fprintf(stderr, "Error al escribir el bitcode en '%s'.\n", output_path);
+                return false;
+            }
+            return true;
+        case EMIT_ASM:
+            return emit_native(module, target_machine, LLVMAssemblyFile, output_path);
+        case EMIT_OBJECT:
+            return emit_native(module, target_machine, LLVMObjectFile, output_path);
+        case EMIT_EXECUTABLE:
+            return emit_executable(module, target_machine, output_path);
+    }
+    return false;
+}
+
+bool parse_emit_kind(const char* name, EmitKind* kind) {
+    if (strcmp(name, "llvm") == 0) *kind = EMIT_LLVM;
+    else if (strcmp(name, "bc") == 0) *kind = EMIT_BITCODE;
+    else if (strcmp(name, "asm") == 0) *kind = EMIT_ASM;
+    else if (strcmp(name, "obj") == 0) *kind = EMIT_OBJECT;
+    else if (strcmp(name, "exe") == 0) *kind = EMIT_EXECUTABLE;
+    else return false;
+    return true;
+}
+
+EmitKind emit_kind_from_path(const char* path) {
+    const char* ext = strrchr(path, '.');
+    if (ext && !strchr(ext, '/')) {
+        if (strcmp(ext, ".ll") == 0) return EMIT_LLVM;
+        if (strcmp(ext, ".bc") == 0) return EMIT_BITCODE;
+        if (strcmp(ext, ".s") == 0) return EMIT_ASM;
+        if (strcmp(ext, ".o") == 0) return EMIT_OBJECT;
+    }
+    return EMIT_EXECUTABLE;
+}
+
+const char* default_output_path(EmitKind kind) {
+    switch (kind) {
+        case EMIT_LLVM:       return "output.ll";
+        case EMIT_BITCODE:    return "output.bc";
+        case EMIT_ASM:        return "output.s";
+        case EMIT_OBJECT:     return "output.o";
+        case EMIT_EXECUTABLE: return "a.out";
+    }
+    return "output.ll";
+}
+
+char* output_path_for_input(const char* input_path, EmitKind kind) {
+    // a/b.hulk -> a/b.ll (o .bc, .s, .o; sin extension para ejecutables)
+    const char* ext = NULL;
+    switch (kind) {
+        case EMIT_LLVM:       ext = ".ll"; break;
+        case EMIT_BITCODE:    ext = ".bc"; break;
+        case EMIT_ASM:        ext = ".s"; break;
+        case EMIT_OBJECT:     ext = ".o"; break;
+        case EMIT_EXECUTABLE: ext = ""; break;
+    }
+    const char* slash = strrchr(input_path, '/');
+    const char* dot = strrchr(slash ? slash + 1 : input_path, '.');
+    size_t stem = dot && dot != (slash ? slash + 1 : input_path) ? (size_t)(dot - input_path) : strlen(input_path);
+
+    // Un ejecutable sin extension no puede pisar a su propia fuente
+    if (kind == EMIT_EXECUTABLE && stem == strlen(input_path))
+        ext = ".out";
+
+    char* path = malloc(stem + strlen(ext) + 1);
+    if (!path) return NULL;
+    memcpy(path, input_path, stem);
+    strcpy(path + stem, ext);
+    return path;
+}
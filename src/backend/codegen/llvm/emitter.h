@@ -0,0 +1,25 @@
+#ifndef LLVM_EMITTER_H
+#define LLVM_EMITTER_H
+
+#include <stdbool.h>
+#include <llvm-c/Core.h>
+#include <llvm-c/TargetMachine.h>
+
+typedef enum {
+    EMIT_LLVM,          // IR textual (.ll)
+    EMIT_BITCODE,       // Bitcode (.bc)
+    EMIT_ASM,           // Ensamblador nativo (.s)
+    EMIT_OBJECT,        // Objeto nativo (.o)
+    EMIT_EXECUTABLE,    // Objeto nativo enlazado como ejecutable
+} EmitKind;
+
+// Escribe el modulo en output_path segun el formato pedido
+bool emit_module(LLVMModuleRef module, LLVMTargetMachineRef target_machine, EmitKind kind, const char* output_path);
+
+bool parse_emit_kind(const char* name, EmitKind* kind);
+EmitKind emit_kind_from_path(const char* path);
+const char* default_output_path(EmitKind kind);
+// Nombre de salida derivado de la fuente para la compilacion por lotes (memoria del llamador)
+char* output_path_for_input(const char* input_path, EmitKind kind);
+
+#endif // LLVM_EMITTER_H
@@ -0,0 +1,128 @@
+#include "field_layout.h"
+#include "utils.h"
+
+static int find_position(const FieldLayout* layout, const char* name) {
+    if (!layout->index_capacity) return -1;
+    int mask = layout->index_capacity - 1;
+    for (int slot = (int)(interned_hash(name) & (uint32_t)mask); layout->index[slot]; slot = (slot + 1) & mask) {
+        int position = layout->index[slot] - 1;
+        if (layout->fields[position].name == name)
+            return position;
+    }
+    return -1;
+}
+
+static void index_field(FieldLayout* layout, int position) {
+    int mask = layout->index_capacity - 1;
+    int slot = (int)(interned_hash(layout->fields[position].name) & (uint32_t)mask);
+    while (layout->index[slot])
+        slot = (slot + 1) & mask;
+    layout->index[slot] = position + 1;
+}
+
+static void add_field(FieldLayout* layout, FieldSlot field) {
+    if (layout->count == layout->capacity) {
+        layout->capacity = layout->capacity ? layout->capacity * 2 : 4;
+        layout->fields = realloc(layout->fields, sizeof(FieldSlot) * (size_t)layout->capacity);
+        if (!layout->fields) DIE("Out of memory in field layout");
+    }
+    layout->fields[layout->count++] = field;
+
+    if ((layout->count * 2) > layout->index_capacity) {
+        layout->index_capacity = layout->index_capacity ? layout->index_capacity * 2 : 8;
+        free(layout->index);
+        layout->index = calloc((size_t)layout->index_capacity, sizeof(int));
+        if (!layout->index) DIE("Out of memory in field layout");
+        for (int i = 0; i < layout->count; i++)
+            index_field(layout, i);
+    } else
+        index_field(layout, layout->count - 1);
+}
+
+static FieldLayout* build_field_layout(LLVMCodeGenerator* generator, TypeDescriptor* type) {
+    FieldLayout* layout = calloc(1, sizeof(FieldLayout));
+    if (!layout) DIE("Out of memory in field layout");
+    layout->type = type;
+    // Object no tiene campos: no se guarda puntero a el
+    layout->has_parent = type->parent && type->parent != type && type->parent->type_id != 0;
+
+    // Los campos propios son las asignaciones del cuerpo, en el mismo orden en
+    // que register_fields los inserto en el scope del tipo
+    SymbolTable* scope = type->info->scope;
+    ExpressionBlockNode* body = type->info->type_def->body;
+    int first_index = layout->has_parent ? 2 : 1;
+    for (int i = 0; i < body->expression_count; i++) {
+        if (body->expressions[i]->type != AST_Node_Variable_Assigment) continue;
+        VariableAssigmentNode* assign = (VariableAssigmentNode*)body->expressions[i];
+        if (is_self_instance(assign->assigment->name)) continue;
+
+        Symbol* symbol = lookup_symbol(scope, assign->assigment->name, SYMBOL_TYPE_FIELD, false);
+        LLVMTypeRef llvm_type;
+        if (!symbol || !symbol->type) {
+            fprintf(stderr, "Error: No se encontró el tipo del atributo '%s' en el tipo '%s'.\n", assign->assigment->name, type->type_name);
+            llvm_type = LLVMInt8TypeInContext(generator->context); // fallback
+        } else
+            llvm_type = get_llvm_type_from_descriptor(symbol->type, generator);
+
+        add_field(layout, (FieldSlot){
+            .name = assign->assigment->name,
+            .type = symbol ? symbol->type : NULL,
+            .llvm_type = llvm_type,
+            .owner = type,
+            .parent_hops = 0,
+            .index = first_index + layout->count,
+            .initializer = assign,
+        });
+    }
+    layout->own_count = layout->count;
+    return layout;
+}
+
+FieldLayout* get_field_layout(LLVMCodeGenerator* generator, TypeDescriptor* type) {
+    int id = type->type_id;
+    if (id >= generator->field_layout_capacity) {
+        int capacity = generator->field_layout_capacity ? generator->field_layout_capacity : 16;
+        while (capacity <= id)
+            capacity *= 2;
+        generator->field_layouts = realloc(generator->field_layouts, sizeof(FieldLayout*) * (size_t)capacity);
+        if (!generator->field_layouts) DIE("Out of memory in field layout");
+        for (int i = generator->field_layout_capacity; i < capacity; i++)
+            generator->field_layouts[i] = NULL;
+        generator->field_layout_capacity = capacity;
+    }
+    if (!generator->field_layouts[id])
+        generator->field_layouts[id] = build_field_layout(generator, type);
+    return generator->field_layouts[id];
+}
+
+bool lookup_field(LLVMCodeGenerator* generator, TypeDescriptor* type, const char* name, FieldSlot* out) {
+    FieldLayout* layout = get_field_layout(generator, type);
+    int position = find_position(layout, name);
+    if (position >= 0) {
+        *out = layout->fields[position];
+        return true;
+    }
+    if (!layout->has_parent)
+        return false;
+
+    // Heredado: se copia del padre con un salto mas y queda en este layout
+    if (!lookup_field(generator, type->parent, name, out))
+        return false;
+    out->parent_hops++;
+    out->initializer = NULL;
+    add_field(layout, *out);
+    return true;
+}
+
+void free_field_layouts(LLVMCodeGenerator* generator) {
+    for (int i = 0; i < generator->field_layout_capacity; i++) {
+        FieldLayout* layout = generator->field_layouts[i];
+        if (!layout) continue;
+        free(layout->fields);
+        free(layout->index);
+        free(layout);
+    }
+    free(generator->field_layouts);
+    generator->field_layouts = NULL;
+    generator->field_layout_capacity = 0;
+}
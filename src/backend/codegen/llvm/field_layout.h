@@ -0,0 +1,41 @@
+#ifndef FIELD_LAYOUT_H
+#define FIELD_LAYOUT_H
+
+#include "generator.h"
+
+// Layout de los campos de un tipo de usuario en su struct LLVM:
+//   0: typeid (i32), 1: puntero al padre (si el padre no es Object), luego los
+//   campos propios en el orden en que se declaran.
+// Los campos heredados viven en el struct del ancestro que los declara; se
+// agregan al layout la primera vez que se consultan desde este tipo, con el
+// ancestro y la cantidad de punteros al padre que hay que seguir para llegar.
+
+typedef struct FieldSlot {
+    char* name;                 // Internado
+    TypeDescriptor* type;       // Tipo HULK del campo
+    LLVMTypeRef llvm_type;
+    TypeDescriptor* owner;      // Tipo que declara el campo
+    int parent_hops;            // Punteros al padre entre el tipo del layout y owner
+    int index;                  // Indice del campo en el struct de owner
+    VariableAssigmentNode* initializer; // Declaracion del campo (solo en los propios)
+} FieldSlot;
+
+typedef struct FieldLayout {
+    TypeDescriptor* type;
+    bool has_parent;            // El struct guarda el puntero al padre en el indice 1
+    int own_count;              // fields[0 .. own_count) son los propios, en orden del struct
+    FieldSlot* fields;          // Propios y despues los heredados ya consultados
+    int count;
+    int capacity;
+    int* index;                 // Hash del nombre -> posicion en fields + 1 (0 = vacio)
+    int index_capacity;         // Potencia de 2, al menos el doble de count
+} FieldLayout;
+
+// Layout de 'type' (se calcula una vez por generador y tipo)
+FieldLayout* get_field_layout(LLVMCodeGenerator* generator, TypeDescriptor* type);
+// Copia en 'out' el campo 'name' (internado) visible en 'type', propio o heredado;
+// false si no existe. Se copia porque consultar un heredado puede mover layout->fields
+bool lookup_field(LLVMCodeGenerator* generator, TypeDescriptor* type, const char* name, FieldSlot* out);
+void free_field_layouts(LLVMCodeGenerator* generator);
+
+#endif // FIELD_LAYOUT_H
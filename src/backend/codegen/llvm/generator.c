@@ -2,9 +2,11 @@
 #include "../../../frontend/hulk_type/type_table.h"
 #include "../../../frontend/ast/ast.h"
 #include "visitors.h"
-#include "scope_stack.h"
 #include "type_scope_stack.h"
+#include "field_layout.h"
 #include "utils.h"
+#include "log.h"
+#include "../ast_accept.h"
 #include "../../../frontend/ast/ast.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -12,26 +14,31 @@
 
 // --- Funciones de inicialización y limpieza del generador de código ---
 LLVMCodeGenerator* create_llvm_code_generator(const char* module_name, TypeTable* type_table) {
+    LLVMCodeGenerator* generator = create_llvm_code_generator_in_context(module_name, type_table, LLVMContextCreate());
+    if (generator)
+        generator->owns_context = true;
+    return generator;
+}
+
+LLVMCodeGenerator* create_llvm_code_generator_in_context(const char* module_name, TypeTable* type_table, LLVMContextRef context) {
     LLVMCodeGenerator* generator = (LLVMCodeGenerator*)malloc(sizeof(LLVMCodeGenerator));
     if (!generator) {
         perror("Failed to allocate LLVMCodeGenerator");
-        exit(EXIT_FAILURE);
+        compilation_fatal(EXIT_FAILURE);
     }
 
     // Inicializar LLVM Context, Module y Builder
-    generator->context = LLVMContextCreate();
+    generator->context = context;
+    generator->owns_context = false;
     generator->module = LLVMModuleCreateWithNameInContext(module_name, generator->context);
     generator->builder = LLVMCreateBuilderInContext(generator->context);
     generator->type_table = type_table;
     generator->type_scope_stack = create_type_scope_stack();
-    
-    // Inicializar el stack de ambitos
-    generator->scope_stack = create_scope_stack();
-    if (!generator->scope_stack) {
-        fprintf(stderr, "Error al crear el stack de ambitos.\n");
-        destroy_llvm_code_generator(generator);
-        return NULL;
-    }
+    generator->symbol_values = NULL;
+    generator->symbol_value_count = 0;
+    generator->current_self = NULL;
+    generator->field_layouts = NULL;
+    generator->field_layout_capacity = 0;
 
     // Asignar las implementaciones de los metodos visit_
     generator->visit_Literal = visit_Literal_impl;
@@ -39,6 +46,7 @@ LLVMCodeGenerator* create_llvm_code_generator(const char* module_name, TypeTable
     generator->visit_BinaryOp = visit_BinaryOp_impl;
     generator->visit_Let = visit_Let_impl;
     generator->visit_Variable = visit_Variable_impl;
+    generator->visit_ReassignNode = visit_ReassignNode_impl;
     generator->visit_Conditional = visit_Conditional_impl;
     generator->visit_WhileLoop = visit_WhileLoop_impl;
     generator->visit_ExpressionBlock = visit_ExpressionBlock_impl;
@@ -58,39 +66,59 @@ LLVMCodeGenerator* create_llvm_code_generator(const char* module_name, TypeTable
 void destroy_llvm_code_generator(LLVMCodeGenerator* generator) {
     if (!generator) return;
 
-    // Destruir el stack de ambitos
-    destroy_scope_stack(generator->scope_stack);
-
     if (generator->type_scope_stack) {
         free(generator->type_scope_stack->stack);
         free(generator->type_scope_stack);
     }
+    free(generator->symbol_values);
+    free_field_layouts(generator);
     LLVMDisposeBuilder(generator->builder);
     if (generator->module) {
         LLVMDisposeModule(generator->module);
     }
-    LLVMContextDispose(generator->context);
+    if (generator->owns_context)
+        LLVMContextDispose(generator->context);
     free(generator);
 }
 
+// Valor LLVM de un simbolo resuelto (NULL si no tiene slot o todavia no se genero)
+LLVMValueRef get_symbol_value(LLVMCodeGenerator* generator, const Symbol* symbol) {
+    if (!symbol || symbol->slot < 0 || symbol->slot >= generator->symbol_value_count)
+        return NULL;
+    return generator->symbol_values[symbol->slot];
+}
+
+void set_symbol_value(LLVMCodeGenerator* generator, const Symbol* symbol, LLVMValueRef value) {
+    if (symbol && symbol->slot >= 0 && symbol->slot < generator->symbol_value_count)
+        generator->symbol_values[symbol->slot] = value;
+}
+
 // --- Funcion principal para generar codigo ---
 LLVMModuleRef generate_code(ProgramNode* program, LLVMCodeGenerator* generator) {
-    printf("Entrando a generate_code\n");
+    LOG_DEBUG(LOG_CAT_CODEGEN, "Entrando a generate_code\n");
     if (!program) {
-        printf("El root es NULL\n");
+        fprintf(stderr, "Error: El root es NULL.\n");
         return NULL;
     }
     if (!generator) {
         fprintf(stderr, "Error: generator es NULL.\n");
         return NULL;
     }
-    printf("Declarando funciones externas\n");
+    free(generator->symbol_values);
+    generator->symbol_values = calloc(program->slot_count ? program->slot_count : 1, sizeof(LLVMValueRef));
+    if (!generator->symbol_values) {
+        perror("Failed to allocate symbol values");
+        compilation_fatal(EXIT_FAILURE);
+    }
+    generator->symbol_value_count = program->slot_count;
+
+    LOG_DEBUG(LOG_CAT_CODEGEN, "Declarando funciones externas\n");
     declare_external_functions(generator->module, generator->context);
-    printf("Declarando tipos de usuario y metodos\n");
+    LOG_DEBUG(LOG_CAT_CODEGEN, "Declarando tipos de usuario y metodos\n");
     declare_user_types_and_methods(generator);
-    printf("Declarando encabezados de funciones\n");
+    LOG_DEBUG(LOG_CAT_CODEGEN, "Declarando encabezados de funciones\n");
     declare_FunctionHeaders_impl(generator, program->function_list);
-    printf("Definiendo metodos de tipos de usuario y valores por defecto\n");
+    LOG_DEBUG(LOG_CAT_CODEGEN, "Definiendo metodos de tipos de usuario y valores por defecto\n");
     define_user_type_methods_and_defaults(generator);
 
     //Generar el cuerpo de la funcion main
@@ -99,18 +127,14 @@ LLVMModuleRef generate_code(ProgramNode* program, LLVMCodeGenerator* generator)
     LLVMValueRef main_fn = LLVMAddFunction(generator->module, "main", main_fn_type);
     LLVMBasicBlockRef entry_block = LLVMAppendBasicBlockInContext(generator->context, main_fn, "entry");
     
-    printf("Definiendo el cuerpo de las funciones\n");
+    LOG_DEBUG(LOG_CAT_CODEGEN, "Definiendo el cuerpo de las funciones\n");
     define_FunctionBodies_impl(generator, program->function_list);
 
     LLVMPositionBuilderAtEnd(generator->builder, entry_block);
-    print_ast_node(program->root, 1);
-    printf("Llamando a accept del nodo raíz (tipo %d)\n", program->root->type);
-    if(program->root->accept){
-        printf("El nodo raíz tiene un método accept definido.\n");
-    } else {
-        printf("El nodo raíz NO tiene un método accept definido.\n");
-    }
-    LLVMValueRef program_result = program->root->accept(program->root, generator);
+    if (LOG_ENABLED(LOG_CAT_CODEGEN, LOG_LEVEL_TRACE))
+        print_ast_node(program->root, 1);
+    LOG_DEBUG(LOG_CAT_CODEGEN, "Llamando a accept del nodo raíz (tipo %d)\n", program->root->type);
+    LLVMValueRef program_result = generic_ast_accept(program->root, generator);
 
     if (program_result) {
         LLVMBuildRet(generator->builder, LLVMConstInt(LLVMInt32TypeInContext(generator->context), 0, 0));
@@ -228,7 +252,7 @@ void declare_user_types_and_methods(LLVMCodeGenerator* generator) {
             for (int j = 0; j < scope->size; ++j) {
                 Symbol* sym = scope->symbols[j];
                 if (sym->kind == SYMBOL_TYPE_METHOD) {
-                    printf("[declare_user_types_and_methods] Declarando método: %s_%s\n", desc->type_name, sym->name);
+                    LOG_DEBUG(LOG_CAT_CODEGEN, "[declare_user_types_and_methods] Declarando método: %s_%s\n", desc->type_name, sym->name);
 
                     generator->declare_method_signature(generator, desc, (FunctionDefinitionNode*)sym->value);
                 }
@@ -241,12 +265,12 @@ void define_user_type_methods_and_defaults(LLVMCodeGenerator* generator) {
     for (int i = 0; i < generator->type_table->count; ++i) {
         TypeDescriptor* desc = generator->type_table->types[i];
         if (desc->tag == HULK_Type_UserDefined) {
-            printf("[define_user_type_methods_and_defaults] Tipo: %s\n", desc->type_name);
+            LOG_DEBUG(LOG_CAT_CODEGEN, "[define_user_type_methods_and_defaults] Tipo: %s\n", desc->type_name);
             SymbolTable* scope = desc->info->scope;
             for (int j = 0; j < scope->size; ++j) {
                 Symbol* sym = scope->symbols[j];
                 if (sym->kind == SYMBOL_TYPE_METHOD) {
-                    printf("  Definiendo método: %s_%s\n", desc->type_name, sym->name);
+                    LOG_DEBUG(LOG_CAT_CODEGEN, "  Definiendo método: %s_%s\n", desc->type_name, sym->name);
                     generator->define_method_body(generator, desc, (FunctionDefinitionNode*)sym->value);
                 } else if (sym->kind == SYMBOL_TYPE_FIELD && !is_self_instance(sym->name)) {
                     //store_field_default(desc, ( VariableAssigmentNode*)expr);
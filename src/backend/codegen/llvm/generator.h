@@ -3,7 +3,6 @@
 
 #include "../../../frontend/ast/ast.h"
 #include "../../../frontend/common/common.h"
-#include "scope_stack.h"
 #include "type_scope_stack.h"
 #include <llvm-c/Core.h>
 #include <llvm-c/Analysis.h>
@@ -17,9 +16,16 @@ struct LLVMCodeGenerator {
     LLVMContextRef context;
     LLVMModuleRef module;
     LLVMBuilderRef builder;
-    ScopeStack* scope_stack; 
+    bool owns_context;      // false si el contexto lo aporta quien crea el generador (p.ej. el JIT)
     TypeTable* type_table; // Tabla de tipos para resolver tipos de nodos AST
     TypeScopeStack* type_scope_stack; // Pila de tipos para manejar el contexto de tipos en la generación de métodos
+    // Los valores de variables, parametros y funciones se guardan junto a los
+    // simbolos semanticos: symbol_values[symbol->slot] (resolve_bindings.h)
+    LLVMValueRef* symbol_values;
+    int symbol_value_count;
+    LLVMValueRef current_self;      // Alloca de self del método que se está generando (NULL fuera de los métodos)
+    struct FieldLayout** field_layouts; // Layout de campos de cada tipo, por type_id (field_layout.h)
+    int field_layout_capacity;
     
 
     // Punteros a las implementaciones de visit_ para CADA tipo de nodo AST
@@ -43,7 +49,10 @@ struct LLVMCodeGenerator {
 };
 
 LLVMCodeGenerator* create_llvm_code_generator(const char* module_name, TypeTable* type_table);
+LLVMCodeGenerator* create_llvm_code_generator_in_context(const char* module_name, TypeTable* type_table, LLVMContextRef context);
 void destroy_llvm_code_generator(LLVMCodeGenerator* generator);
+LLVMValueRef get_symbol_value(LLVMCodeGenerator* generator, const Symbol* symbol);
+void set_symbol_value(LLVMCodeGenerator* generator, const Symbol* symbol, LLVMValueRef value);
 LLVMModuleRef generate_code(ProgramNode* program, LLVMCodeGenerator* generator);
 void declare_external_functions(LLVMModuleRef module, LLVMContextRef context);
 void declare_user_types_and_methods(LLVMCodeGenerator* generator);
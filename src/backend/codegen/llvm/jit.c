@@ -0,0 +1,61 @@
+#include "jit.h"
+#include "target.h"
+#include <llvm-c/Error.h>
+#include <llvm-c/LLJIT.h>
+#include <stdio.h>
+
+static bool report_jit_error(LLVMErrorRef error, const char* what) {
+    if (!error) return false;
+    char* message = LLVMGetErrorMessage(error);
+    fprintf(stderr, "Error del JIT (%s): %s\n", what, message);
+    LLVMDisposeErrorMessage(message);
+    return true;
+}
+
+bool run_module_in_jit(LLVMModuleRef module, LLVMOrcThreadSafeContextRef context, LLVMTargetMachineRef target_machine, int* exit_code) {
+    initialize_native_target();
+
+    LLVMOrcLLJITBuilderRef builder = LLVMOrcCreateLLJITBuilder();
+    if (target_machine)
+        LLVMOrcLLJITBuilderSetJITTargetMachineBuilder(builder, LLVMOrcJITTargetMachineBuilderCreateFromTargetMachine(target_machine));
+
+    LLVMOrcLLJITRef jit = NULL;
+    if (report_jit_error(LLVMOrcCreateLLJIT(&jit, builder), "creacion")) {
+        LLVMDisposeModule(module);
+        LLVMOrcDisposeThreadSafeContext(context);
+        return false;
+    }
+
+    // Resolver printf, malloc, sqrt, etc. contra los simbolos del propio proceso
+    LLVMOrcJITDylibRef main_dylib = LLVMOrcLLJITGetMainJITDylib(jit);
+    LLVMOrcDefinitionGeneratorRef process_symbols = NULL;
+    if (report_jit_error(LLVMOrcCreateDynamicLibrarySearchGeneratorForProcess(&process_symbols, LLVMOrcLLJITGetGlobalPrefix(jit), NULL, NULL), "simbolos del proceso")) {
+        LLVMDisposeModule(module);
+        LLVMOrcDisposeThreadSafeContext(context);
+        LLVMOrcDisposeLLJIT(jit);
+        return false;
+    }
+    LLVMOrcJITDylibAddGenerator(main_dylib, process_symbols);
+
+    // El ThreadSafeModule mantiene vivo el contexto; nuestra referencia ya no hace falta
+    LLVMOrcThreadSafeModuleRef thread_safe_module = LLVMOrcCreateNewThreadSafeModule(module, context);
+    LLVMOrcDisposeThreadSafeContext(context);
+    if (report_jit_error(LLVMOrcLLJITAddLLVMIRModule(jit, main_dylib, thread_safe_module), "modulo")) {
+        LLVMOrcDisposeThreadSafeModule(thread_safe_module);
+        LLVMOrcDisposeLLJIT(jit);
+        return false;
+    }
+
+    LLVMOrcExecutorAddress main_address = 0;
+    if (report_jit_error(LLVMOrcLLJITLookup(jit, &main_address, "main"), "busqueda de main")) {
+        LLVMOrcDisposeLLJIT(jit);
+        return false;
+    }
+
+    int (*main_fn)(void) = (int (*)(void))(uintptr_t)main_address;
+    *exit_code = main_fn();
+    fflush(stdout);
+
+    report_jit_error(LLVMOrcDisposeLLJIT(jit), "liberacion");
+    return true;
+}
@@ -0,0 +1,15 @@
+#ifndef LLVM_JIT_H
+#define LLVM_JIT_H
+
+#include <stdbool.h>
+#include <llvm-c/Core.h>
+#include <llvm-c/Orc.h>
+#include <llvm-c/TargetMachine.h>
+
+// Compila el modulo con LLJIT y ejecuta su funcion main.
+// El modulo debe pertenecer al contexto de `context`; el JIT toma posesion de ambos.
+// target_machine (opcional) fija el nivel de codegen; el JIT tambien toma posesion de ella.
+// Retorna false si el JIT falla; en caso contrario deja en exit_code el valor retornado por main.
+bool run_module_in_jit(LLVMModuleRef module, LLVMOrcThreadSafeContextRef context, LLVMTargetMachineRef target_machine, int* exit_code);
+
+#endif // LLVM_JIT_H
@@ -0,0 +1,54 @@
+#include "optimizer.h"
+#include <llvm-c/Error.h>
+#include <llvm-c/Transforms/PassBuilder.h>
+#include <stdio.h>
+
+static const char* preset_pipeline(OptimizationLevel level) {
+    switch (level) {
+        case OPT_LEVEL_O1: return "default<O1>";
+        case OPT_LEVEL_O2: return "default<O2>";
+        case OPT_LEVEL_O3: return "default<O3>";
+        case OPT_LEVEL_Os: return "default<Os>";
+        case OPT_LEVEL_Oz: return "default<Oz>";
+        default:           return NULL;
+    }
+}
+
+bool optimize_module(LLVMModuleRef module, LLVMTargetMachineRef target_machine, const OptimizationOptions* options) {
+    if (!module || !options) return false;
+
+    // Con -O0 y sin pipeline personalizado el modulo se emite tal cual
+    const char* pipeline = options->passes ? options->passes : preset_pipeline(options->level);
+    if (!pipeline) return true;
+
+    // Igual que clang: vectorizacion y unrolling a partir de -O2, y -Os/-Oz cuentan
+    // como -O2. -Oz solo apaga la vectorizacion de loops, que es la que agranda el codigo
+    OptimizationLevel level = options->level;
+    bool aggressive = level == OPT_LEVEL_O2 || level == OPT_LEVEL_O3 || level == OPT_LEVEL_Os || level == OPT_LEVEL_Oz;
+
+    LLVMPassBuilderOptionsRef pass_options = LLVMCreatePassBuilderOptions();
+    LLVMPassBuilderOptionsSetLoopVectorization(pass_options, aggressive && level != OPT_LEVEL_Oz);
+    LLVMPassBuilderOptionsSetSLPVectorization(pass_options, aggressive);
+    LLVMPassBuilderOptionsSetLoopInterleaving(pass_options, aggressive);
+    LLVMPassBuilderOptionsSetLoopUnrolling(pass_options, aggressive);
+
+    LLVMErrorRef error = LLVMRunPasses(module, pipeline, target_machine, pass_options);
+    LLVMDisposePassBuilderOptions(pass_options);
+
+    if (error) {
+        char* message = LLVMGetErrorMessage(error);
+        fprintf(stderr, "Error al ejecutar el pipeline de optimizacion '%s': %s\n", pipeline, message);
+        LLVMDisposeErrorMessage(message);
+        return false;
+    }
+    return true;
+}
+
+LLVMCodeGenOptLevel codegen_opt_level(OptimizationLevel level) {
+    switch (level) {
+        case OPT_LEVEL_O0: return LLVMCodeGenLevelNone;
+        case OPT_LEVEL_O1: return LLVMCodeGenLevelLess;
+        case OPT_LEVEL_O3: return LLVMCodeGenLevelAggressive;
+        default:           return LLVMCodeGenLevelDefault;
+    }
+}
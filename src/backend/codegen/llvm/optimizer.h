@@ -0,0 +1,28 @@
+#ifndef LLVM_OPTIMIZER_H
+#define LLVM_OPTIMIZER_H
+
+#include <stdbool.h>
+#include <llvm-c/Core.h>
+#include <llvm-c/TargetMachine.h>
+
+typedef enum {
+    OPT_LEVEL_O0,
+    OPT_LEVEL_O1,
+    OPT_LEVEL_O2,
+    OPT_LEVEL_O3,
+    OPT_LEVEL_Os,
+    OPT_LEVEL_Oz,
+} OptimizationLevel;
+
+typedef struct OptimizationOptions {
+    OptimizationLevel level;    // Preset estandar (-O0..-O3, -Os, -Oz)
+    const char* passes;         // Pipeline personalizado (sintaxis de opt -passes=...), NULL para usar el preset
+} OptimizationOptions;
+
+// Ejecuta el pipeline de optimizacion sobre el modulo. Retorna false si LLVM reporta un error.
+bool optimize_module(LLVMModuleRef module, LLVMTargetMachineRef target_machine, const OptimizationOptions* options);
+
+// Nivel de optimizacion equivalente para la generacion de codigo maquina
+LLVMCodeGenOptLevel codegen_opt_level(OptimizationLevel level);
+
+#endif // LLVM_OPTIMIZER_H
@@ -0,0 +1,56 @@
+#include "target.h"
+#include <llvm-c/Target.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+static void initialize_native_target_once(void) {
+    LLVMInitializeNativeTarget();
+    LLVMInitializeNativeAsmPrinter();
+    LLVMInitializeNativeAsmParser();
+}
+
+void initialize_native_target(void) {
+    static pthread_once_t initialized = PTHREAD_ONCE_INIT;
+    pthread_once(&initialized, initialize_native_target_once);
+}
+
+LLVMTargetMachineRef create_host_target_machine(LLVMCodeGenOptLevel level) {
+    initialize_native_target();
+
+    char* triple = LLVMGetDefaultTargetTriple();
+    char* error = NULL;
+    LLVMTargetRef target = NULL;
+
+    if (LLVMGetTargetFromTriple(triple, &target, &error) != 0) {
+        fprintf(stderr, "Error: no se pudo obtener el target para '%s': %s\n", triple, error);
+        LLVMDisposeMessage(error);
+        LLVMDisposeMessage(triple);
+        return NULL;
+    }
+
+    char* cpu = LLVMGetHostCPUName();
+    char* features = LLVMGetHostCPUFeatures();
+
+    LLVMTargetMachineRef target_machine = LLVMCreateTargetMachine(
+        target, triple, cpu, features, level, LLVMRelocPIC, LLVMCodeModelDefault);
+
+    LLVMDisposeMessage(features);
+    LLVMDisposeMessage(cpu);
+    LLVMDisposeMessage(triple);
+    return target_machine;
+}
+
+void configure_module_target(LLVMModuleRef module, LLVMTargetMachineRef target_machine) {
+    if (!module || !target_machine) return;
+
+    char* triple = LLVMGetTargetMachineTriple(target_machine);
+    LLVMSetTarget(module, triple);
+    LLVMDisposeMessage(triple);
+
+    LLVMTargetDataRef data_layout = LLVMCreateTargetDataLayout(target_machine);
+    char* layout = LLVMCopyStringRepOfTargetData(data_layout);
+    LLVMSetDataLayout(module, layout);
+    LLVMDisposeMessage(layout);
+    LLVMDisposeTargetData(data_layout);
+}
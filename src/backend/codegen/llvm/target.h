@@ -0,0 +1,16 @@
+#ifndef LLVM_TARGET_H
+#define LLVM_TARGET_H
+
+#include <llvm-c/Core.h>
+#include <llvm-c/TargetMachine.h>
+
+// Inicializa los targets de LLVM (solo la primera vez que se llama)
+void initialize_native_target(void);
+
+// Crea una TargetMachine para el host con el nivel de optimizacion de codegen indicado
+LLVMTargetMachineRef create_host_target_machine(LLVMCodeGenOptLevel level);
+
+// Fija el triple y el data layout del modulo segun la TargetMachine
+void configure_module_target(LLVMModuleRef module, LLVMTargetMachineRef target_machine);
+
+#endif // LLVM_TARGET_H
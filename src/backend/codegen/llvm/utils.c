@@ -2,13 +2,15 @@
 #include "../../../frontend/ast/ast.h"
 #include "utils.h"
 #include "generator.h"
+#include "field_layout.h"
+#include "log.h"
 
 LLVMTypeRef get_llvm_type_from_descriptor(TypeDescriptor* desc, LLVMCodeGenerator* generator) {
     if (!desc) {
         fprintf(stderr, "Error: Descriptor de tipo nulo al obtener tipo LLVM.\n");
         return NULL;
     }
-    printf("[get_llvm_type_from_descriptor] Resolviendo tipo: %s (tag=%d)\n", desc->type_name, desc->tag);
+    LOG_TRACE(LOG_CAT_CODEGEN, "[get_llvm_type_from_descriptor] Resolviendo tipo: %s (tag=%d)\n", desc->type_name, desc->tag);
     if (desc->llvm_type && !(LLVMGetTypeKind(desc->llvm_type) == LLVMStructTypeKind && LLVMIsOpaqueStruct(desc->llvm_type)))
         return desc->llvm_type;
 
@@ -34,22 +36,12 @@ LLVMTypeRef get_llvm_type_from_descriptor(TypeDescriptor* desc, LLVMCodeGenerato
             if (LLVMGetTypeKind(desc->llvm_type) == LLVMStructTypeKind && !LLVMIsOpaqueStruct(desc->llvm_type))
                 return desc->llvm_type;
 
-            TypeInfo* info = desc->info;
-            SymbolTable* scope = info->scope;
-
-            int n_fields = 1;
-            // Si tiene padre, añade puntero al padre como segundo campo
+            // Puntero al padre primero (si hay herencia), despues los campos propios
             int has_parent = (desc->parent && desc->parent != desc && desc->parent->type_id != 0); // Que tenga padre pero que no sea object_type
-            if (has_parent) n_fields+=1;
-
-            int n_own = 0;
-            for (int i = 0; i < scope->size; ++i) {
-                if (scope->symbols[i]->kind == SYMBOL_TYPE_FIELD && !is_self_instance(scope->symbols[i]->name)) {
-                    n_own = n_own + 1;
-                }
-            }
-            n_fields += n_own;
+            LLVMTypeRef parent_type = has_parent ? get_llvm_type_from_descriptor(desc->parent, generator) : NULL;
+            FieldLayout* layout = get_field_layout(generator, desc);
 
+            int n_fields = 1 + (has_parent ? 1 : 0) + layout->own_count;
             LLVMTypeRef* members = malloc(sizeof(LLVMTypeRef) * n_fields);
             int idx = 0;
             
@@ -57,32 +49,16 @@ LLVMTypeRef get_llvm_type_from_descriptor(TypeDescriptor* desc, LLVMCodeGenerato
             members[idx++] = LLVMInt32TypeInContext(generator->context);
 
             // puntero al padre si hay herencia
-            if (has_parent) {
-                LLVMTypeRef parent_type = get_llvm_type_from_descriptor(desc->parent, generator);
+            if (has_parent)
                 members[idx++] = LLVMPointerType(parent_type, 0);
-            }
 
-            for (int i = 0; i < scope->size; ++i) {
-                if (scope->symbols[i]->kind == SYMBOL_TYPE_FIELD && !is_self_instance(scope->symbols[i]->name)) {
-                    TypeDescriptor* attr_desc = scope->symbols[i]->type;
-                    if (!attr_desc) {
-                        fprintf(stderr, "Error: No se encontró el tipo del atributo '%s' en el tipo '%s'.\n", scope->symbols[i]->name, desc->type_name);
-                        members[idx++] = LLVMInt8TypeInContext(generator->context); // fallback
-                    } else {
-                        members[idx++] = get_llvm_type_from_descriptor(attr_desc, generator);
-                    }
-                }
-            }
-            printf("Antes de LLVMStructSetBody: %s, n=%d\n", desc->type_name, n_fields);
-            for (int i = 0; i < n_fields; ++i) {
-                printf("  Campo %d: tipo LLVM kind = %d\n", i, LLVMGetTypeKind(members[i]));
-            }
+            for (int i = 0; i < layout->own_count; ++i)
+                members[layout->fields[i].index] = layout->fields[i].llvm_type;
             LLVMStructSetBody(desc->llvm_type, members, n_fields, 0);
-            printf("Después de LLVMStructSetBody: %s, kind=%d\n", desc->type_name, LLVMGetTypeKind(desc->llvm_type)); 
-            printf("Definiendo body de %s: desc=%p, llvm_type=%p\n", desc->type_name, (void*)desc, (void*)desc->llvm_type);
-            printf("Struct %s creado con %d campos:\n", desc->type_name, n_fields);
-            for (int i = 0; i < n_fields; ++i) {
-                printf("  Campo %d: tipo LLVM kind = %d\n", i, LLVMGetTypeKind(members[i]));
+            LOG_DEBUG(LOG_CAT_CODEGEN, "Struct %s creado con %d campos: desc=%p, llvm_type=%p\n", desc->type_name, n_fields, (void*)desc, (void*)desc->llvm_type);
+            if (LOG_ENABLED(LOG_CAT_CODEGEN, LOG_LEVEL_TRACE)) {
+                for (int i = 0; i < n_fields; ++i)
+                    LOG_TRACE(LOG_CAT_CODEGEN, "  Campo %d: tipo LLVM kind = %d\n", i, LLVMGetTypeKind(members[i]));
             }
             free(members);          
             break;
@@ -96,15 +72,17 @@ LLVMTypeRef get_llvm_type_from_descriptor(TypeDescriptor* desc, LLVMCodeGenerato
 }
 
 BuiltinKind get_builtin_kind(const char* name) {
-    if (strcmp(name, "print") == 0) return BUILTIN_PRINT;
-    if (strcmp(name, "sqrt") == 0) return BUILTIN_SQRT;
-    if (strcmp(name, "sin") == 0) return BUILTIN_SIN;
-    if (strcmp(name, "cos") == 0) return BUILTIN_COS;
-    if (strcmp(name, "exp") == 0) return BUILTIN_EXP;
-    if (strcmp(name, "log") == 0) return BUILTIN_LOG;
-    if (strcmp(name, "pow") == 0) return BUILTIN_POW;
-    if (strcmp(name, "fmod") == 0) return BUILTIN_FMOD;
-    if (strcmp(name, "rand") == 0) return BUILTIN_RAND;
+    // 'name' viene del AST (internado): se comparan punteros
+    const InternedNames* names = interned_names();
+    if (name == names->print) return BUILTIN_PRINT;
+    if (name == names->sqrt) return BUILTIN_SQRT;
+    if (name == names->sin) return BUILTIN_SIN;
+    if (name == names->cos) return BUILTIN_COS;
+    if (name == names->exp) return BUILTIN_EXP;
+    if (name == names->log) return BUILTIN_LOG;
+    if (name == names->pow) return BUILTIN_POW;
+    if (name == names->fmod) return BUILTIN_FMOD;
+    if (name == names->rand) return BUILTIN_RAND;
     return BUILTIN_NONE;
 }
 
@@ -115,6 +93,7 @@ const char* get_print_format(LLVMTypeRef type, LLVMContextRef context) {
     return "<unknown>\n";
 }
 
-bool is_self_instance(char* name) {
-    return strcmp(name, "self") == 0 || strcmp(name, "this") == 0;
+bool is_self_instance(const char* name) {
+    const InternedNames* names = interned_names();
+    return name == names->self || name == names->this_;
 }
\ No newline at end of file
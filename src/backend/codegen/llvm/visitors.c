@@ -2,8 +2,10 @@
 #include "../../../frontend/hulk_type/type_table.h"
 #include "type_scope_stack.h"
 #include "utils.h"
+#include "field_layout.h"
 #include <stdio.h>
 #include "builtins.h"
+#include "log.h"
 #include "../ast_accept.h"
 #include <llvm-c/Target.h>
 
@@ -26,7 +28,7 @@ LLVMValueRef visit_Literal_impl(LLVMCodeGenerator* self, LiteralNode* node) {
     }
 }
 LLVMValueRef visit_UnaryOp_impl(LLVMCodeGenerator* self, UnaryOperationNode* node) {
-    LLVMValueRef operand_val = node->operand->accept(node->operand, self);
+    LLVMValueRef operand_val = generic_ast_accept(node->operand, self);
     if (!operand_val) {
         fprintf(stderr, "Error: No se pudo generar el valor del operando para la operación unaria.\n");
         return NULL;
@@ -56,24 +58,24 @@ LLVMValueRef visit_UnaryOp_impl(LLVMCodeGenerator* self, UnaryOperationNode* nod
 }
 
 LLVMValueRef visit_BinaryOp_impl(LLVMCodeGenerator* self, BinaryOperationNode* node) {
-    printf("[visit_BinaryOp_impl] node: %p\n", (void*)node);
-    printf("[visit_BinaryOp_impl] node->operator: %d\n", node->operator);
-    printf("[visit_BinaryOp_impl] node->left: %p\n", (void*)node->left);
-    printf("[visit_BinaryOp_impl] node->right: %p\n", (void*)node->right);
-    if (!node->left || !node->left->accept) {
-    fprintf(stderr, "Error: Nodo izquierdo o su método accept es NULL en BinaryOp.\n");
+    LOG_TRACE(LOG_CAT_CODEGEN, "[visit_BinaryOp_impl] node: %p\n", (void*)node);
+    LOG_TRACE(LOG_CAT_CODEGEN, "[visit_BinaryOp_impl] node->operator: %d\n", node->operator);
+    LOG_TRACE(LOG_CAT_CODEGEN, "[visit_BinaryOp_impl] node->left: %p\n", (void*)node->left);
+    LOG_TRACE(LOG_CAT_CODEGEN, "[visit_BinaryOp_impl] node->right: %p\n", (void*)node->right);
+    if (!node->left) {
+    fprintf(stderr, "Error: Nodo izquierdo NULL en BinaryOp.\n");
     fprintf(stderr, "Tipo de nodo izquierdo: %d\n", node->left ? node->left->type : -1);
     abort();
     }
-    LLVMValueRef left_val = node->left->accept(node->left, self);
-    LLVMValueRef right_val = node->right->accept(node->right, self);
+    LLVMValueRef left_val = generic_ast_accept(node->left, self);
+    LLVMValueRef right_val = generic_ast_accept(node->right, self);
 
     if (LLVMGetTypeKind(LLVMTypeOf(left_val)) == LLVMPointerTypeKind)
          left_val = LLVMBuildLoad2(self->builder, LLVMGetElementType(LLVMTypeOf(left_val)), left_val, "loadtmp");
     if (LLVMGetTypeKind(LLVMTypeOf(right_val)) == LLVMPointerTypeKind)
         right_val = LLVMBuildLoad2(self->builder, LLVMGetElementType(LLVMTypeOf(right_val)), right_val, "loadtmp");
 
-    printf("[visit_BinaryOp_impl] left_val: %p, right_val: %p\n", (void*)left_val, (void*)right_val);
+    LOG_TRACE(LOG_CAT_CODEGEN, "[visit_BinaryOp_impl] left_val: %p, right_val: %p\n", (void*)left_val, (void*)right_val);
 
     if (!left_val || !right_val) {
         fprintf(stderr, "Error: No se pudieron generar los valores de los operandos para la operación binaria.\n");
@@ -83,11 +85,13 @@ LLVMValueRef visit_BinaryOp_impl(LLVMCodeGenerator* self, BinaryOperationNode* n
     LLVMTypeRef left_type = LLVMTypeOf(left_val);
     LLVMTypeRef right_type = LLVMTypeOf(right_val);
 
-    char* left_type_str = LLVMPrintTypeToString(left_type);
-    char* right_type_str = LLVMPrintTypeToString(right_type);
-    printf("[visit_BinaryOp_impl] Tipo izquierdo: %s, Tipo derecho: %s\n", left_type_str, right_type_str);
-    LLVMDisposeMessage(left_type_str);
-    LLVMDisposeMessage(right_type_str);
+    if (LOG_ENABLED(LOG_CAT_CODEGEN, LOG_LEVEL_TRACE)) {
+        char* left_type_str = LLVMPrintTypeToString(left_type);
+        char* right_type_str = LLVMPrintTypeToString(right_type);
+        LOG_TRACE(LOG_CAT_CODEGEN, "[visit_BinaryOp_impl] Tipo izquierdo: %s, Tipo derecho: %s\n", left_type_str, right_type_str);
+        LLVMDisposeMessage(left_type_str);
+        LLVMDisposeMessage(right_type_str);
+    }
 
     // --- Operaciones entre números (double) ---
     if (LLVMGetTypeKind(left_type) == LLVMDoubleTypeKind && 
@@ -150,7 +154,7 @@ LLVMValueRef visit_BinaryOp_impl(LLVMCodeGenerator* self, BinaryOperationNode* n
 }
 
 LLVMValueRef visit_Conditional_impl(LLVMCodeGenerator* self, ConditionalNode* node) {
-    LLVMValueRef cond_val = node->condition->accept(node->condition, self);
+    LLVMValueRef cond_val = generic_ast_accept(node->condition, self);
     if (!cond_val) {
         fprintf(stderr, "Error: No se pudo generar el valor de la condición.\n");
         return NULL;
@@ -173,14 +177,14 @@ LLVMValueRef visit_Conditional_impl(LLVMCodeGenerator* self, ConditionalNode* no
     LLVMBuildCondBr(self->builder, cond_val, then_bb, else_bb);
 
     LLVMPositionBuilderAtEnd(self->builder, then_bb);
-    LLVMValueRef then_val = node->then_branch->accept(node->then_branch, self);
+    LLVMValueRef then_val = generic_ast_accept(node->then_branch, self);
     LLVMBuildBr(self->builder, merge_bb);
     then_bb = LLVMGetInsertBlock(self->builder); 
 
     LLVMPositionBuilderAtEnd(self->builder, else_bb);
     LLVMValueRef else_val = NULL;
     if (node->else_branch) {
-        else_val = node->else_branch->accept(node->else_branch, self);
+        else_val = generic_ast_accept(node->else_branch, self);
     }
     LLVMBuildBr(self->builder, merge_bb);
     else_bb = LLVMGetInsertBlock(self->builder); 
@@ -206,19 +210,16 @@ LLVMValueRef visit_Conditional_impl(LLVMCodeGenerator* self, ConditionalNode* no
 }
 
 LLVMValueRef visit_Let_impl(LLVMCodeGenerator* self, LetInNode* node){
-    IrSymbolTable* new_scope = create_ir_symbol_table(0, current_scope(self->scope_stack));
-    push_scope(self->scope_stack, new_scope);
-
     LLVMBasicBlockRef current_block = LLVMGetInsertBlock(self->builder);
     LLVMValueRef current_func = LLVMGetBasicBlockParent(current_block);
     LLVMBasicBlockRef entry_block = LLVMGetEntryBasicBlock(current_func);
 
-    printf("Visitando LetIn \n");
-    printf("Analizando asignaciones \n");
+    LOG_TRACE(LOG_CAT_CODEGEN, "Visitando LetIn \n");
+    LOG_TRACE(LOG_CAT_CODEGEN, "Analizando asignaciones \n");
     for (int i = 0; i < node->assigment_count; ++i) {
         VariableAssigment* assign = node->assigments[i]->assigment;
         char* name = assign->name;
-        LLVMValueRef init_val = assign->value->accept(assign->value, self);
+        LLVMValueRef init_val = generic_ast_accept(assign->value, self);
         LLVMTypeRef type = LLVMTypeOf(init_val);
 
         LLVMPositionBuilderAtEnd(self->builder, entry_block);
@@ -226,18 +227,15 @@ LLVMValueRef visit_Let_impl(LLVMCodeGenerator* self, LetInNode* node){
         LLVMPositionBuilderAtEnd(self->builder, current_block); // Restaurar posición
 
         LLVMBuildStore(self->builder, init_val, alloca);
-        insert_ir_symbol(current_scope(self->scope_stack), name, alloca);
+        set_symbol_value(self, node->scope->symbols[i], alloca); // Un simbolo por asignacion, en orden
     }
 
     if (node->body == NULL) {
         fprintf(stderr, "Error: El cuerpo (body) del let-in es NULL.\n");
-        pop_scope(self->scope_stack);
         return NULL;
     }
 
-    LLVMValueRef body_value = node->body->accept(node->body, self);
-    pop_scope(self->scope_stack);
-    return body_value;
+    return generic_ast_accept(node->body, self);
 }
 
 LLVMValueRef visit_WhileLoop_impl(LLVMCodeGenerator* self, WhileLoopNode* node) {
@@ -251,7 +249,7 @@ LLVMValueRef visit_WhileLoop_impl(LLVMCodeGenerator* self, WhileLoopNode* node)
 
     // Condición
     LLVMPositionBuilderAtEnd(self->builder, cond_bb);
-    LLVMValueRef cond_val = node->condition->accept(node->condition, self);
+    LLVMValueRef cond_val = generic_ast_accept(node->condition, self);
     if (LLVMGetTypeKind(LLVMTypeOf(cond_val)) == LLVMDoubleTypeKind) {
         cond_val = LLVMBuildFCmp(
             self->builder, LLVMRealONE, cond_val,
@@ -263,7 +261,7 @@ LLVMValueRef visit_WhileLoop_impl(LLVMCodeGenerator* self, WhileLoopNode* node)
 
     // Cuerpo del while
     LLVMPositionBuilderAtEnd(self->builder, body_bb);
-    LLVMValueRef body_val = node->body->accept(node->body, self);
+    LLVMValueRef body_val = generic_ast_accept(node->body, self);
     LLVMBuildBr(self->builder, cond_bb);
 
     // Después del while
@@ -275,7 +273,7 @@ LLVMValueRef visit_WhileLoop_impl(LLVMCodeGenerator* self, WhileLoopNode* node)
 LLVMValueRef visit_ExpressionBlock_impl(LLVMCodeGenerator* self, ExpressionBlockNode* node) {
     LLVMValueRef last_val = NULL;
     for (int i = 0; i < node->expression_count; ++i) {
-        last_val = node->expressions[i]->accept(node->expressions[i], self);
+        last_val = generic_ast_accept(node->expressions[i], self);
     }
     if (last_val) {
         LLVMTypeRef t = LLVMTypeOf(last_val);
@@ -290,87 +288,49 @@ LLVMValueRef visit_ExpressionBlock_impl(LLVMCodeGenerator* self, ExpressionBlock
     return last_val;
 }
 
-int count_fields_to_skip(TypeDescriptor* type)
-{
-    return (type->parent && type->parent != type && type->parent->type_id != 0 ? 2 : 1);
-}
-
-// Devuelve el número de saltos de parent y el índice del campo en ese struct
-bool find_field_in_hierarchy(TypeDescriptor* type, const char* field_name, int* out_parent_hops, int* out_field_index, LLVMCodeGenerator* self) {
-    int hops = 0;
-    while (type) {
-        SymbolTable* scope = type->info->scope;
-        int idx = 0;
-        // Salta typeid y parent
-        for (int i = 0; i < scope->size; ++i) {
-            Symbol* sym = scope->symbols[i];
-            if (sym->kind == SYMBOL_TYPE_FIELD && !is_self_instance(sym->name)) {
-                if (strcmp(sym->name, field_name) == 0) {
-                    *out_parent_hops = hops;
-                    *out_field_index = idx + count_fields_to_skip(type); // 0:typeid, 1:parent, 2...:campos
-                    return true;
-                }
-                idx++;
-            }
-        }
-        if (type->parent && type->parent != type && type->parent->type_id != 0)
-            type = type->parent, hops++;
-        else
-            break;
+// Puntero al campo 'field' de un objeto de tipo 'type', siguiendo los punteros al padre
+static LLVMValueRef build_field_pointer(LLVMCodeGenerator* self, TypeDescriptor* type, LLVMValueRef object, const FieldSlot* field) {
+    for (int h = 0; h < field->parent_hops; ++h) {
+        LLVMValueRef parent_ptr = LLVMBuildStructGEP2(self->builder, type->llvm_type, object, 1, "parent");
+        object = LLVMBuildLoad2(self->builder, LLVMPointerType(type->parent->llvm_type, 0), parent_ptr, "parent_val");
+        type = type->parent;
     }
-    return false;
+    return LLVMBuildStructGEP2(self->builder, field->owner->llvm_type, object, field->index, field->name);
 }
 
 LLVMValueRef visit_Variable_impl(LLVMCodeGenerator* self, VariableNode* node) {
-    IrSymbolTable* current = current_scope(self->scope_stack);
-    IrSymbol* symbol = lookup_ir_symbol(current, node->name);
+    // Variables de let, parámetros y self: el valor está en el slot del símbolo
+    LLVMValueRef value = node->binding && node->binding->kind != SYMBOL_FUNCTION
+        ? get_symbol_value(self, node->binding) : NULL;
 
-    if (symbol) {
-        LLVMTypeRef t = LLVMTypeOf(symbol->value);
+    if (value) {
+        LLVMTypeRef t = LLVMTypeOf(value);
         if (LLVMGetTypeKind(t) == LLVMPointerTypeKind &&
             LLVMGetElementType(t) == LLVMInt8TypeInContext(self->context)) {
-            return symbol->value;
+            return value;
         }
         if (LLVMGetTypeKind(t) == LLVMPointerTypeKind) {
-            return LLVMBuildLoad2(self->builder, LLVMGetElementType(t), symbol->value, node->name);
+            return LLVMBuildLoad2(self->builder, LLVMGetElementType(t), value, node->name);
         }
-        return symbol->value;
+        return value;
     }
 
-    // --- Si no está en el scope local, se busca en self (campos del struct) ---
-    IrSymbol* self_symbol = lookup_ir_symbol(current, "self");
-    if (self_symbol) {
-        LLVMValueRef self_ptr = self_symbol->value;
+    // --- Si no es un valor local, dentro de un método es un campo de self ---
+    if (self->current_self) {
+        LLVMValueRef self_ptr = self->current_self;
         TypeDescriptor* type = current_type(self->type_scope_stack);
         if (!type) {
             fprintf(stderr, "Error: No hay tipo actual en la pila de tipos para acceder a campos.\n");
             return NULL;
         }
-        int parent_hops = 0, field_index = -1;
-        if (!find_field_in_hierarchy(type, node->name, &parent_hops, &field_index, self)) {
+        FieldSlot field;
+        if (!lookup_field(self, type, node->name, &field)) {
             fprintf(stderr, "Error: Campo '%s' no encontrado en la jerarquía de '%s'.\n", node->name, type->type_name);
             return NULL;
         }
         LLVMValueRef cur_ptr = LLVMBuildLoad2(self->builder, LLVMPointerType(type->llvm_type, 0), self_ptr, "self_val");
-        for (int h = 0; h < parent_hops; ++h) {
-            LLVMValueRef parent_ptr = LLVMBuildStructGEP2(self->builder, type->llvm_type, cur_ptr, 1, "parent");
-            cur_ptr = LLVMBuildLoad2(self->builder, LLVMPointerType(type->parent->llvm_type, 0), parent_ptr, "parent_val");
-            type = type->parent;
-        }
-        LLVMValueRef field_ptr = LLVMBuildStructGEP2(self->builder, type->llvm_type, cur_ptr, field_index, node->name);
-        SymbolTable* scope = type->info->scope;
-        Symbol* field_sym = NULL;
-        for (int i = 0, idx = 0; i < scope->size; ++i) {
-            Symbol* sym = scope->symbols[i];
-            if (sym->kind == SYMBOL_TYPE_FIELD && !is_self_instance(sym->name)) {
-                if (strcmp(sym->name, node->name) == 0) {
-                    field_sym = sym;
-                    break;
-                }
-                idx++;
-            }
-        }
-        return LLVMBuildLoad2(self->builder, get_llvm_type_from_descriptor(field_sym->type, self), field_ptr, node->name);
+        LLVMValueRef field_ptr = build_field_pointer(self, type, cur_ptr, &field);
+        return LLVMBuildLoad2(self->builder, field.llvm_type, field_ptr, node->name);
     }
 
     fprintf(stderr, "Error: Variable o campo '%s' no encontrado en el ámbito actual ni en self.\n", node->name);
@@ -378,23 +338,23 @@ LLVMValueRef visit_Variable_impl(LLVMCodeGenerator* self, VariableNode* node) {
 }
 
 LLVMValueRef visit_ReassignNode_impl(LLVMCodeGenerator* self, ReassignNode* node){
-    IrSymbol* symbol = lookup_ir_symbol(current_scope(self->scope_stack), node->name);
-    if (!symbol) {
+    LLVMValueRef variable = get_symbol_value(self, node->binding);
+    if (!variable) {
         fprintf(stderr, "Error: Variable '%s' no encontrada en el ámbito actual.\n", node->name);
         return NULL;
     }
-    LLVMValueRef new_value = node->value->accept(node->value, self);
+    LLVMValueRef new_value = generic_ast_accept(node->value, self);
     if (!new_value) {
         fprintf(stderr, "Error: No se pudo generar el valor para la reasignación de la variable '%s'.\n", node->name);
         return NULL;
     }
     LLVMTypeRef type = LLVMTypeOf(new_value);
-    if (LLVMGetTypeKind(type) != LLVMGetTypeKind(LLVMTypeOf(symbol->value))) {
+    if (LLVMGetTypeKind(type) != LLVMGetTypeKind(LLVMGetElementType(LLVMTypeOf(variable)))) {
         fprintf(stderr, "Error: Tipo de valor '%s' no coincide con el tipo de la variable.\n", node->name);
         return NULL;
     }
-    LLVMBuildStore(self->builder, new_value, symbol->value);
-    return symbol->value;
+    LLVMBuildStore(self->builder, new_value, variable);
+    return new_value; // La reasignación vale el nuevo valor (a := b := 1)
 }
 
 LLVMValueRef visit_FunctionDefinition_impl(LLVMCodeGenerator* self, FunctionDefinitionNode* node) {
@@ -432,9 +392,6 @@ LLVMValueRef visit_FunctionDefinition_impl(LLVMCodeGenerator* self, FunctionDefi
     LLVMBasicBlockRef entry = LLVMAppendBasicBlockInContext(self->context, fn, "entry");
     LLVMPositionBuilderAtEnd(self->builder, entry);
 
-    IrSymbolTable* fn_scope = create_ir_symbol_table(0, current_scope(self->scope_stack));
-    push_scope(self->scope_stack, fn_scope);
-
   for (int i = 0; i < node->param_count; ++i) {
         if (!param_types[i]) {
             fprintf(stderr, "Error: param_types[%d] es NULL en la función '%s'.\n", i, node->name);
@@ -451,14 +408,14 @@ LLVMValueRef visit_FunctionDefinition_impl(LLVMCodeGenerator* self, FunctionDefi
         }
         LLVMValueRef alloca = LLVMBuildAlloca(self->builder, param_types[i], node->params[i]->name);
         LLVMBuildStore(self->builder, param, alloca);
-        insert_ir_symbol(fn_scope, node->params[i]->name, alloca);
+        set_symbol_value(self, lookup_symbol(node->scope, node->params[i]->name, SYMBOL_PARAMETER, false), alloca);
     }
 
     LLVMBasicBlockRef body_bb = LLVMAppendBasicBlockInContext(self->context, fn, "body");
     LLVMBuildBr(self->builder, body_bb);
     LLVMPositionBuilderAtEnd(self->builder, body_bb);
 
-    LLVMValueRef body_val = node->body->accept(node->body, self);
+    LLVMValueRef body_val = generic_ast_accept(node->body, self);
     LLVMTypeRef ret_type = get_llvm_type_from_descriptor(fn_symbol->type, self);
 
     if (ret_type == LLVMVoidTypeInContext(self->context)) {
@@ -466,11 +423,10 @@ LLVMValueRef visit_FunctionDefinition_impl(LLVMCodeGenerator* self, FunctionDefi
     } else if (body_val) {
         LLVMBuildRet(self->builder, body_val);
     } else {
-        printf("Error no se generó el cuerpo de la función: %s", node->name);
+        fprintf(stderr, "Error: No se generó el cuerpo de la función '%s'.\n", node->name);
         LLVMBuildRet(self->builder, LLVMConstNull(ret_type));
     }
 
-    pop_scope(self->scope_stack);
     free(param_types);
     return fn;
 }
@@ -495,7 +451,7 @@ void declare_FunctionHeaders_impl(LLVMCodeGenerator* self, FunctionDefinitionLis
                 free(param_types);
                 return;
             }
-            printf("param_symbol->type ptr: %p\n", (void*)param_symbol->type);
+            LOG_TRACE(LOG_CAT_CODEGEN, "param_symbol->type ptr: %p\n", (void*)param_symbol->type);
             param_types[j] = get_llvm_type_from_descriptor(param_symbol->type, self);
         }
         if(fn_node->static_return_type == NULL) {
@@ -508,8 +464,8 @@ void declare_FunctionHeaders_impl(LLVMCodeGenerator* self, FunctionDefinitionLis
             free(param_types);
             return;
         }
-        printf("La funcion devuelve: %s\n", function_symbol->type->type_name);
-        printf("El tipo de retorno de la función %s es %s\n", fn_node->name, function_symbol->type->type_name);
+        LOG_TRACE(LOG_CAT_CODEGEN, "La funcion devuelve: %s\n", function_symbol->type->type_name);
+        LOG_TRACE(LOG_CAT_CODEGEN, "El tipo de retorno de la función %s es %s\n", fn_node->name, function_symbol->type->type_name);
         LLVMTypeRef ret_type = get_llvm_type_from_descriptor(function_symbol->type, self);
         if (!ret_type) {
             fprintf(stderr, "Error: ret_type es NULL para la función '%s'.\n", fn_node->name);
@@ -517,7 +473,8 @@ void declare_FunctionHeaders_impl(LLVMCodeGenerator* self, FunctionDefinitionLis
             return;
         }
         LLVMTypeRef fn_type = LLVMFunctionType(ret_type, param_types, fn_node->param_count, 0);
-        LLVMAddFunction(self->module, fn_node->name, fn_type);
+        LLVMValueRef fn = LLVMAddFunction(self->module, fn_node->name, fn_type);
+        set_symbol_value(self, lookup_symbol(fn_node->scope, fn_node->name, SYMBOL_FUNCTION, true), fn);
         free(param_types);
     }
 }
@@ -536,7 +493,7 @@ void declare_FunctionDefinitionList_impl(LLVMCodeGenerator* self, FunctionDefini
 
 void declare_method_signature_impl(LLVMCodeGenerator* self, TypeDescriptor* type, FunctionDefinitionNode* fn) {
     // El primer parámetro es self (puntero al struct)
-    printf("[declare] fn=%p, fn->name='%s'\n", (void*)fn, fn->name ? fn->name : "(null)");
+    LOG_TRACE(LOG_CAT_CODEGEN, "[declare] fn=%p, fn->name='%s'\n", (void*)fn, fn->name ? fn->name : "(null)");
     Symbol* fn_symbol = lookup_symbol(fn->scope, fn->name, SYMBOL_ANY, true);
     int total_params = fn->param_count + 1;
     LLVMTypeRef* param_types = malloc(sizeof(LLVMTypeRef) * total_params);
@@ -549,7 +506,7 @@ void declare_method_signature_impl(LLVMCodeGenerator* self, TypeDescriptor* type
     char method_name[256];
     snprintf(method_name, sizeof(method_name), "%s_%s", type->type_name, fn->name);
 
-    printf("[declare_method_signature_impl] Declarando método: %s\n", method_name);
+    LOG_DEBUG(LOG_CAT_CODEGEN, "[declare_method_signature_impl] Declarando método: %s\n", method_name);
 
     LLVMTypeRef fn_type = LLVMFunctionType(ret_type, param_types, total_params, 0);
     LLVMAddFunction(self->module, method_name, fn_type);
@@ -558,11 +515,11 @@ void declare_method_signature_impl(LLVMCodeGenerator* self, TypeDescriptor* type
 
 void define_method_body_impl(LLVMCodeGenerator* self, TypeDescriptor* type, FunctionDefinitionNode* fn) {
     push_type(self->type_scope_stack, type);
-    printf("[define ] fn=%p, fn->name='%s'\n", (void*)fn, fn->name ? fn->name : "(null)");
+    LOG_TRACE(LOG_CAT_CODEGEN, "[define ] fn=%p, fn->name='%s'\n", (void*)fn, fn->name ? fn->name : "(null)");
     char method_name[256];
     snprintf(method_name, sizeof(method_name), "%s_%s", type->type_name, fn->name);
 
-    printf("[define_method_body_impl] Definiendo método: %s\n", method_name);
+    LOG_DEBUG(LOG_CAT_CODEGEN, "[define_method_body_impl] Definiendo método: %s\n", method_name);
 
     Symbol* fn_symbol = lookup_symbol(fn->scope, fn->name, SYMBOL_ANY, true);
     LLVMValueRef llvm_fn = LLVMGetNamedFunction(self->module, method_name);
@@ -571,10 +528,6 @@ void define_method_body_impl(LLVMCodeGenerator* self, TypeDescriptor* type, Func
         return;
     }
 
-    // Prepara el scope para el método
-    IrSymbolTable* method_scope = create_ir_symbol_table(0, current_scope(self->scope_stack));
-    push_scope(self->scope_stack, method_scope);
-
     LLVMBasicBlockRef entry = LLVMAppendBasicBlockInContext(self->context, llvm_fn, "entry");
     LLVMPositionBuilderAtEnd(self->builder, entry);    
 
@@ -583,7 +536,9 @@ void define_method_body_impl(LLVMCodeGenerator* self, TypeDescriptor* type, Func
     LLVMTypeRef self_type = LLVMPointerType(type->llvm_type, 0);
     LLVMValueRef self_alloca = LLVMBuildAlloca(self->builder, self_type, "self");
     LLVMBuildStore(self->builder, self_param, self_alloca);
-    insert_ir_symbol(method_scope, "self", self_alloca);
+    set_symbol_value(self, lookup_symbol(type->info->scope, interned_names()->self, SYMBOL_TYPE_FIELD, false), self_alloca);
+    LLVMValueRef outer_self = self->current_self;
+    self->current_self = self_alloca;
 
     // Mapea los parámetros del método (a partir del segundo parámetro)
     for (int i = 0; i < fn->param_count; ++i) {
@@ -592,10 +547,10 @@ void define_method_body_impl(LLVMCodeGenerator* self, TypeDescriptor* type, Func
         LLVMTypeRef param_type = get_llvm_type_from_descriptor(param_symbol->type, self);
         LLVMValueRef alloca = LLVMBuildAlloca(self->builder, param_type, fn->params[i]->name);
         LLVMBuildStore(self->builder, param, alloca);
-        insert_ir_symbol(method_scope, fn->params[i]->name, alloca);
+        set_symbol_value(self, param_symbol, alloca);
     }
 
-    LLVMValueRef body_val = fn->body->accept(fn->body, self);
+    LLVMValueRef body_val = generic_ast_accept(fn->body, self);
 
     LLVMTypeRef ret_type = get_llvm_type_from_descriptor(fn_symbol->type, self);
 
@@ -608,7 +563,7 @@ void define_method_body_impl(LLVMCodeGenerator* self, TypeDescriptor* type, Func
         LLVMBuildRet(self->builder, LLVMConstNull(ret_type));
     }
 
-    pop_scope(self->scope_stack);
+    self->current_self = outer_self;
     pop_type(self->type_scope_stack);
 }
 
@@ -617,14 +572,16 @@ LLVMValueRef visit_FunctionCall_impl(LLVMCodeGenerator* self, FunctionCallNode*
     if (builtin_result) return builtin_result;
 
     // Llamada a función de usuario
-    LLVMValueRef fn = LLVMGetNamedFunction(self->module, node->name);
+    LLVMValueRef fn = get_symbol_value(self, node->binding);
+    if (!fn)
+        fn = LLVMGetNamedFunction(self->module, node->name);
     if (!fn) {
         fprintf(stderr, "Error: función '%s' no encontrada en el módulo LLVM.\n", node->name);
         return NULL;
     }
     LLVMValueRef* args = malloc(node->arg_count * sizeof(LLVMValueRef));
     for (int i = 0; i < node->arg_count; ++i) {
-        args[i] = node->args[i]->accept(node->args[i], self);
+        args[i] = generic_ast_accept(node->args[i], self);
         if (LLVMGetTypeKind(LLVMTypeOf(args[i])) == LLVMPointerTypeKind)
             args[i] = LLVMBuildLoad2(self->builder, LLVMGetElementType(LLVMTypeOf(args[i])), args[i], "loadtmp");
         if (!args[i]) {
@@ -658,7 +615,6 @@ LLVMValueRef initialize_parent(LLVMCodeGenerator* self, TypeDescriptor* parent_t
 
     NewNode* new_node = (NewNode*)calloc(1, sizeof(NewNode));
     new_node->base.type = AST_Node_New;
-    new_node->base.accept = generic_ast_accept;
     new_node->type_name = parent_type->type_name;
     new_node->arg_count = parent_arg_count;
     new_node->base.return_type = parent_type;
@@ -672,7 +628,7 @@ LLVMValueRef initialize_parent(LLVMCodeGenerator* self, TypeDescriptor* parent_t
         new_node->args = NULL;
     }
 
-    LLVMValueRef result = new_node->base.accept((ASTNode*)new_node, self);
+    LLVMValueRef result = generic_ast_accept((ASTNode*)new_node, self);
     
     if (!result) {
         fprintf(stderr, "Error: No se pudo inicializar el tipo padre '%s'.\n", parent_type->type_name);
@@ -680,7 +636,7 @@ LLVMValueRef initialize_parent(LLVMCodeGenerator* self, TypeDescriptor* parent_t
         free(new_node);
         return NULL;
     }
-    printf("Tipo padre '%s' inicializado correctamente.\n", parent_type->type_name);
+    LOG_TRACE(LOG_CAT_CODEGEN, "Tipo padre '%s' inicializado correctamente.\n", parent_type->type_name);
     
     if(new_node->args) free(new_node->args);
     free(new_node);
@@ -690,34 +646,31 @@ LLVMValueRef initialize_parent(LLVMCodeGenerator* self, TypeDescriptor* parent_t
 
 LLVMValueRef visit_NewNode_impl(LLVMCodeGenerator* self, NewNode* node) {
     TypeDescriptor* desc = type_table_lookup(self->type_table, node->type_name);
-    printf("Instanciando: %s, desc=%p, llvm_type=%p, kind=%d\n",
-        desc->type_name, (void*)desc, (void*)desc->llvm_type, LLVMGetTypeKind(desc->llvm_type));
     if (!desc) {
         fprintf(stderr, "Error: Tipo '%s' no encontrado en NewNode.\n", node->type_name);
         return NULL;
     }
+    LOG_TRACE(LOG_CAT_CODEGEN, "Instanciando: %s, desc=%p, llvm_type=%p\n",
+        desc->type_name, (void*)desc, (void*)desc->llvm_type);
     if (desc->llvm_type == NULL || !desc->llvm_type) {
         fprintf(stderr, "Error: Tipo '%s' no tiene un tipo LLVM asociado.\n", node->type_name);
         return NULL;
     }
-    printf("Creando instancia de tipo: %s\n", desc->type_name);
-    printf("desc->llvm_type: %p\n", (void*)desc->llvm_type);
-    printf("LLVMGetTypeKind(desc->llvm_type): %d\n", LLVMGetTypeKind(desc->llvm_type));
+    LOG_TRACE(LOG_CAT_CODEGEN, "Creando instancia de tipo: %s\n", desc->type_name);
     LLVMTypeRef struct_type = desc->llvm_type;
     LLVMTypeRef i64_type = LLVMInt64TypeInContext(self->context);
-    printf("struct_type: %p\n", (void*)struct_type);
     if (LLVMGetTypeKind(struct_type) != LLVMStructTypeKind || LLVMCountStructElementTypes(struct_type) == 0) {
         fprintf(stderr, "Error: struct_type aún no tiene un cuerpo definido.\n");
-        exit(1);
+        compilation_fatal(1);
     }
     if (LLVMCountStructElementTypes(struct_type) == 0) {
         fprintf(stderr, "Error: struct_type '%s' está sin definir.\n", desc->type_name);
-        exit(1);
+        compilation_fatal(1);
     }
     LLVMTargetDataRef data_layout = LLVMGetModuleDataLayout(self->module);
     if (!data_layout) {
         fprintf(stderr, "Error: No se pudo obtener el layout de datos del módulo.\n");
-        exit(1);
+        compilation_fatal(1);
     }
 
     uint64_t struct_size_bytes = LLVMStoreSizeOfType(data_layout, struct_type);
@@ -728,80 +681,57 @@ LLVMValueRef visit_NewNode_impl(LLVMCodeGenerator* self, NewNode* node) {
     LLVMValueRef raw_ptr = LLVMBuildCall2(self->builder, LLVMGetElementType(LLVMTypeOf(malloc_fn)), malloc_fn, &struct_size, 1, "malloc_call");
     LLVMValueRef instance = LLVMBuildBitCast(self->builder, raw_ptr, LLVMPointerType(struct_type, 0), "instance");
 
-    SymbolTable* scope = desc->info->scope;
     TypeDefinitionNode* type_def = desc->info->type_def;
-    ExpressionBlockNode* body = type_def->body;
-
-    int field_index = 0;
+    FieldLayout* layout = get_field_layout(self, desc);
 
     LLVMValueRef typeid_val = LLVMConstInt(LLVMInt32TypeInContext(self->context), desc->type_id, 0);
-    LLVMValueRef typeid_ptr = LLVMBuildStructGEP2(self->builder, struct_type, instance, field_index++, "typeid");
+    LLVMValueRef typeid_ptr = LLVMBuildStructGEP2(self->builder, struct_type, instance, 0, "typeid");
     LLVMBuildStore(self->builder, typeid_val, typeid_ptr);
 
-    if (desc->parent && desc->parent != desc && desc->parent->type_id != 0) {
+    if (layout->has_parent) {
         LLVMValueRef parent_instance = initialize_parent(self, desc->parent, type_def->parent_args, type_def->parent_arg_count);
-        LLVMValueRef parent_ptr = LLVMBuildStructGEP2(self->builder, struct_type, instance, field_index++, "parent");
+        LLVMValueRef parent_ptr = LLVMBuildStructGEP2(self->builder, struct_type, instance, 1, "parent");
         LLVMBuildStore(self->builder, parent_instance, parent_ptr);
     }
 
-    for (int i = 0; i < scope->size; ++i) {
-        Symbol* field_sym = scope->symbols[i];
-        if (field_sym->kind != SYMBOL_TYPE_FIELD || is_self_instance(field_sym->name)) continue;
-        char* field_name = field_sym->name;
-        printf("Procesando campo: %s\n", field_name);
+    for (int i = 0; i < layout->own_count; ++i) {
+        FieldSlot field = layout->fields[i]; // Copia: generar el valor puede agregar heredados a fields
+        LOG_TRACE(LOG_CAT_CODEGEN, "Procesando campo: %s\n", field.name);
 
-        // Buscar asignación para ese campo en el cuerpo de la definición
-        VariableAssigmentNode* assign_node = NULL;
-        for (int j = 0; j < body->expression_count; ++j) {
-            if (body->expressions[j]->type == AST_Node_Variable_Assigment) {
-                VariableAssigmentNode* va = (VariableAssigmentNode*)body->expressions[j];
-                if (strcmp(va->assigment->name, field_name) == 0) {
-                    assign_node = va;
+        LLVMValueRef value_to_store = NULL;
+        ASTNode* rhs = field.initializer->assigment->value;
+        // Si el valor es un parámetro,se usa el argumento recibido
+        if (rhs->type == AST_Node_Variable) {
+            VariableNode* var = (VariableNode*)rhs;
+            int param_index = -1;
+            for (int k = 0; k < type_def->param_count; ++k) {
+                if (type_def->params[k]->name == var->name) {
+                    param_index = k;
                     break;
                 }
             }
-        }
-        printf("Asignación encontrada: %s\n", assign_node ? "Sí" : "No");
-        LLVMValueRef value_to_store = NULL;
-        if (assign_node) {
-            ASTNode* rhs = assign_node->assigment->value;
-            // Si el valor es un parámetro,se usa el argumento recibido
-            if (rhs->type == AST_Node_Variable) {
-                VariableNode* var = (VariableNode*)rhs;
-                int param_index = -1;
-                for (int k = 0; k < type_def->param_count; ++k) {
-                    if (strcmp(type_def->params[k]->name, var->name) == 0) {
-                        param_index = k;
-                        break;
-                    }
-                }
-                if (param_index != -1 && param_index < node->arg_count) {
-                    value_to_store = node->args[param_index]->accept(node->args[param_index], self);
-                } else {
-                    value_to_store = rhs->accept(rhs, self);
-                }
+            if (param_index != -1 && param_index < node->arg_count) {
+                value_to_store = generic_ast_accept(node->args[param_index], self);
             } else {
-                value_to_store = rhs->accept(rhs, self);
+                value_to_store = generic_ast_accept(rhs, self);
             }
         } else {
-            LLVMTypeRef field_type = get_llvm_type_from_descriptor(field_sym->type, self);
-            value_to_store = LLVMConstNull(field_type);
+            value_to_store = generic_ast_accept(rhs, self);
         }
         if (!value_to_store) {
-            fprintf(stderr, "Error: No se pudo generar el valor para el campo '%s'.\n", field_name);
+            fprintf(stderr, "Error: No se pudo generar el valor para el campo '%s'.\n", field.name);
             continue;
         }
 
-        LLVMValueRef field_ptr = LLVMBuildStructGEP2(self->builder, struct_type, instance, field_index, field_name);
+        LLVMValueRef field_ptr = LLVMBuildStructGEP2(self->builder, struct_type, instance, field.index, field.name);
         LLVMBuildStore(self->builder, value_to_store, field_ptr);
-        field_index += 1;
     }
 
     return instance;
 }
 
 LLVMValueRef visit_AttributeAccess_impl(LLVMCodeGenerator* self, AttributeAccessNode* node) {
-    LLVMValueRef obj_val = node->object->accept(node->object, self);
+    LLVMValueRef obj_val = generic_ast_accept(node->object, self);
     TypeDescriptor* obj_type = node->object->return_type;
     if (!obj_type || obj_type->tag != HULK_Type_UserDefined) {
         fprintf(stderr, "Error: acceso a atributo/método en tipo no soportado.\n");
@@ -809,31 +739,13 @@ LLVMValueRef visit_AttributeAccess_impl(LLVMCodeGenerator* self, AttributeAccess
     }
 
     if (!node->is_method_call) {
-        int parent_hops = 0, field_index = -1;
-        if (!find_field_in_hierarchy(obj_type, node->attribute_name, &parent_hops, &field_index, self)) {
+        FieldSlot field;
+        if (!lookup_field(self, obj_type, node->attribute_name, &field)) {
             fprintf(stderr, "Error: atributo '%s' no encontrado en la jerarquía de '%s'.\n", node->attribute_name, obj_type->type_name);
             return NULL;
         }
-        LLVMValueRef cur_ptr = obj_val;
-        for (int h = 0; h < parent_hops; ++h) {
-            LLVMValueRef parent_ptr = LLVMBuildStructGEP2(self->builder, obj_type->llvm_type, cur_ptr, 1, "parent");
-            cur_ptr = LLVMBuildLoad2(self->builder, LLVMPointerType(obj_type->parent->llvm_type, 0), parent_ptr, "parent_val");
-            obj_type = obj_type->parent;
-        }
-        LLVMValueRef field_ptr = LLVMBuildStructGEP2(self->builder, obj_type->llvm_type, cur_ptr, field_index, node->attribute_name);
-        SymbolTable* scope = obj_type->info->scope;
-        Symbol* field_sym = NULL;
-        for (int i = 0, idx = 0; i < scope->size; ++i) {
-            Symbol* sym = scope->symbols[i];
-            if (sym->kind == SYMBOL_TYPE_FIELD && !is_self_instance(sym->name)) {
-                if (strcmp(sym->name, node->attribute_name) == 0) {
-                    field_sym = sym;
-                    break;
-                }
-                idx++;
-            }
-        }
-        return LLVMBuildLoad2(self->builder, get_llvm_type_from_descriptor(field_sym->type, self), field_ptr, node->attribute_name);
+        LLVMValueRef field_ptr = build_field_pointer(self, obj_type, obj_val, &field);
+        return LLVMBuildLoad2(self->builder, field.llvm_type, field_ptr, node->attribute_name);
     } else {
         // si no está en tipo actual,se busca en el padre
         TypeDescriptor* search_type = obj_type;
@@ -848,7 +760,7 @@ LLVMValueRef visit_AttributeAccess_impl(LLVMCodeGenerator* self, AttributeAccess
                 LLVMValueRef* args = malloc(sizeof(LLVMValueRef) * total_args);
                 args[0] = cur_obj; // self
                 for (int i = 0; i < node->arg_count; ++i) {
-                    args[i+1] = node->args[i]->accept(node->args[i], self);
+                    args[i+1] = generic_ast_accept(node->args[i], self);
                 }
                 LLVMValueRef call = LLVMBuildCall2(self->builder, fn_type, fn, args, total_args, "");
                 free(args);
@@ -0,0 +1,127 @@
+#include "batch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "compiler.h"
+#include "emitter.h"
+#include "target.h"
+#include "log.h"
+
+typedef struct BatchJob {
+    const char* input_path;
+    char* output_path;
+} BatchJob;
+
+// Cola de trabajos que comparten los workers. Cada compilacion trabaja sobre su
+// propia copia del preludio, asi que lo unico que se protege es la cola y la salida.
+typedef struct BatchQueue {
+    const CompilerOptions* options;
+    const CompilerPrelude* prelude;
+    BatchJob* jobs;
+    int count;
+    int next;               // Primer trabajo que nadie tomo todavia
+    int failed;
+    pthread_mutex_t lock;   // Protege next, failed y las lineas [OK]/[FAIL]
+} BatchQueue;
+
+// Compila un archivo en el hilo del worker
+static int compile_job(const CompilerOptions* options, const CompilerPrelude* prelude, BatchJob* job) {
+    job->output_path = output_path_for_input(job->input_path, options->emit_kind);
+    if (!job->output_path) {
+        fprintf(stderr, "No se pudo preparar la compilacion de '%s'\n", job->input_path);
+        return 1;
+    }
+
+    CompilerOptions job_options = *options;
+    job_options.input_path = job->input_path;
+    job_options.input_paths = &job->input_path;
+    job_options.input_count = 1;
+    job_options.output_path = job->output_path;
+
+    SourceBuffer source;
+    if (!source_buffer_load(&source, job->input_path)) {
+        fprintf(stderr, "No se pudo abrir el archivo '%s'\n", job->input_path);
+        return 1;
+    }
+    TimeReport report;
+    time_report_init(&report, options->time_report);
+    int exit_code = compile_program(&source, &job_options, prelude, &report);
+    source_buffer_release(&source);
+    time_report_print(&report, stderr);
+    return exit_code;
+}
+
+static void* batch_worker(void* arg) {
+    BatchQueue* queue = arg;
+    for (;;) {
+        pthread_mutex_lock(&queue->lock);
+        BatchJob* job = queue->next < queue->count ? &queue->jobs[queue->next++] : NULL;
+        pthread_mutex_unlock(&queue->lock);
+        if (!job)
+            return NULL;
+
+        int exit_code = compile_job(queue->options, queue->prelude, job);
+
+        pthread_mutex_lock(&queue->lock);
+        if (exit_code == 0)
+            printf("  [OK] %s -> %s\n", job->input_path, job->output_path);
+        else {
+            printf("  [FAIL] %s (codigo %d)\n", job->input_path, exit_code);
+            queue->failed++;
+        }
+        fflush(stdout);
+        pthread_mutex_unlock(&queue->lock);
+
+        free(job->output_path);
+        job->output_path = NULL;
+    }
+}
+
+int run_batch_compile(const CompilerOptions* options) {
+    int jobs = options->jobs;
+    if (jobs <= 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = cores > 0 ? (int)cores : 1;
+    }
+    if (jobs > options->input_count)
+        jobs = options->input_count;
+
+    // El preludio y LLVM se preparan una vez y los comparten todos los workers
+    initialize_native_target();
+    CompilerPrelude prelude;
+    load_compiler_prelude(&prelude);
+    LOG_INFO(LOG_CAT_DRIVER, "Compilando %d archivos con %d workers\n", options->input_count, jobs);
+
+    BatchQueue queue = {
+        .options = options,
+        .prelude = &prelude,
+        .jobs = calloc(options->input_count, sizeof(BatchJob)),
+        .count = options->input_count,
+    };
+    pthread_mutex_init(&queue.lock, NULL);
+    for (int i = 0; i < queue.count; i++)
+        queue.jobs[i].input_path = options->input_paths[i];
+
+    // Si no se puede crear algun hilo se sigue con los que haya; sin ninguno,
+    // el hilo principal compila toda la cola
+    pthread_t* threads = malloc(sizeof(pthread_t) * jobs);
+    int started = 0;
+    while (started < jobs && pthread_create(&threads[started], NULL, batch_worker, &queue) == 0)
+        started++;
+    if (started == 0)
+        batch_worker(&queue);
+    for (int i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+
+    if (queue.failed > 0)
+        fprintf(stderr, "%d de %d archivos fallaron.\n", queue.failed, options->input_count);
+    int exit_code = queue.failed > 0 ? 1 : 0;
+
+    pthread_mutex_destroy(&queue.lock);
+    free(threads);
+    free(queue.jobs);
+    free_compiler_prelude(&prelude);
+    return exit_code;
+}
@@ -0,0 +1,13 @@
+#ifndef DRIVER_BATCH_H
+#define DRIVER_BATCH_H
+
+#include "options.h"
+
+// Compila todos los archivos de options->input_paths en este proceso, con un pool
+// de options->jobs hilos (uno por nucleo si es 0) que toman archivos de una cola.
+// Cada salida se escribe junto a su fuente (a.hulk -> a.ll, a.o, ...). Un error
+// fatal en un archivo solo corta su compilacion (fatal.h).
+// Retorna 0 si todas las compilaciones terminaron bien.
+int run_batch_compile(const CompilerOptions* options);
+
+#endif // DRIVER_BATCH_H
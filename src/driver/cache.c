@@ -0,0 +1,267 @@
+#include "cache.h"
+#include "log.h"
+#include "../../build/build_id.h"
+#include <llvm-c/TargetMachine.h>
+#include <llvm/Config/llvm-config.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ---------------------------------------------------------------------------
+// SHA-256 (FIPS 180-4)
+// ---------------------------------------------------------------------------
+
+typedef struct Sha256 {
+    uint32_t state[8];
+    uint64_t length;            // Bytes procesados
+    unsigned char block[64];
+    size_t block_size;
+} Sha256;
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_init(Sha256* sha) {
+    static const uint32_t initial[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+    memcpy(sha->state, initial, sizeof(initial));
+    sha->length = 0;
+    sha->block_size = 0;
+}
+
+static void sha256_compress(Sha256* sha, const unsigned char* block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 | (uint32_t)block[i * 4 + 2] << 8 | block[i * 4 + 3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = sha->state[0], b = sha->state[1], c = sha->state[2], d = sha->state[3];
+    uint32_t e = sha->state[4], f = sha->state[5], g = sha->state[6], h = sha->state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+        uint32_t t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    sha->state[0] += a; sha->state[1] += b; sha->state[2] += c; sha->state[3] += d;
+    sha->state[4] += e; sha->state[5] += f; sha->state[6] += g; sha->state[7] += h;
+}
+
+static void sha256_update(Sha256* sha, const void* data, size_t size) {
+    const unsigned char* bytes = data;
+    sha->length += size;
+    while (size > 0) {
+        size_t chunk = 64 - sha->block_size;
+        if (chunk > size) chunk = size;
+        memcpy(sha->block + sha->block_size, bytes, chunk);
+        sha->block_size += chunk;
+        bytes += chunk;
+        size -= chunk;
+        if (sha->block_size == 64) {
+            sha256_compress(sha, sha->block);
+            sha->block_size = 0;
+        }
+    }
+}
+
+static void sha256_final_hex(Sha256* sha, char hex[COMPILE_CACHE_KEY_SIZE]) {
+    uint64_t bits = sha->length * 8;
+    unsigned char padding[72] = { 0x80 };
+    size_t pad = (sha->block_size < 56 ? 56 : 120) - sha->block_size;
+    for (int i = 0; i < 8; i++)
+        padding[pad + i] = (unsigned char)(bits >> (56 - 8 * i));
+    sha256_update(sha, padding, pad + 8);
+
+    for (int i = 0; i < 8; i++)
+        snprintf(hex + i * 8, 9, "%08x", sha->state[i]);
+}
+
+// ---------------------------------------------------------------------------
+// Clave y entradas
+// ---------------------------------------------------------------------------
+
+// Cada campo va precedido por su longitud para que "ab"+"c" y "a"+"bc" no colisionen
+static void hash_field(Sha256* sha, const char* value) {
+    uint64_t size = value ? strlen(value) : UINT64_MAX;
+    sha256_update(sha, &size, sizeof(size));
+    if (value) sha256_update(sha, value, strlen(value));
+}
+
+void compile_cache_key(const char* source, size_t size, const CompilerOptions* options, char key[COMPILE_CACHE_KEY_SIZE]) {
+    Sha256 sha;
+    sha256_init(&sha);
+
+    hash_field(&sha, "hulk-cache-1");
+    hash_field(&sha, HULK_BUILD_ID);
+    hash_field(&sha, LLVM_VERSION_STRING);
+
+    // El codigo nativo depende del target del host
+    char* triple = LLVMGetDefaultTargetTriple();
+    char* cpu = LLVMGetHostCPUName();
+    char* features = LLVMGetHostCPUFeatures();
+    hash_field(&sha, triple);
+    hash_field(&sha, cpu);
+    hash_field(&sha, features);
+    LLVMDisposeMessage(features);
+    LLVMDisposeMessage(cpu);
+    LLVMDisposeMessage(triple);
+
+    // Opciones que cambian el artefacto (-o solo cambia donde se copia)
+    char flags[64];
+    snprintf(flags, sizeof(flags), "run=%d emit=%d O=%d", options->run, options->run ? -1 : (int)options->emit_kind, (int)options->optimization.level);
+    hash_field(&sha, flags);
+    hash_field(&sha, options->optimization.passes);
+    if (!options->run && options->emit_kind == EMIT_EXECUTABLE)
+        hash_field(&sha, getenv("HULK_LINKER"));
+
+    uint64_t source_size = size;
+    sha256_update(&sha, &source_size, sizeof(source_size));
+    sha256_update(&sha, source, size);
+    sha256_final_hex(&sha, key);
+}
+
+char* compile_cache_entry_path(const char* cache_dir, const char* key, const CompilerOptions* options) {
+    const char* ext = ".bc";
+    if (!options->run) {
+        switch (options->emit_kind) {
+            case EMIT_LLVM:       ext = ".ll"; break;
+            case EMIT_BITCODE:    ext = ".bc"; break;
+            case EMIT_ASM:        ext = ".s"; break;
+            case EMIT_OBJECT:     ext = ".o"; break;
+            case EMIT_EXECUTABLE: ext = ".exe"; break;
+        }
+    }
+    size_t size = strlen(cache_dir) + strlen(key) + strlen(ext) + 3;
+    char* path = malloc(size);
+    if (!path) return NULL;
+    snprintf(path, size, "%s/%.2s/%s%s", cache_dir, key, key + 2, ext);
+    return path;
+}
+
+static bool copy_fd(int from, int to) {
+    char buffer[65536];
+    ssize_t n;
+    while ((n = read(from, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t written = 0; written < n; ) {
+            ssize_t w = write(to, buffer + written, (size_t)(n - written));
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            written += w;
+        }
+    }
+    return n == 0;
+}
+
+bool compile_cache_fetch(const char* entry_path, const char* output_path, bool executable) {
+    int from = open(entry_path, O_RDONLY);
+    if (from < 0) return false;
+
+    int to = open(output_path, O_WRONLY | O_CREAT | O_TRUNC, executable ? 0755 : 0644);
+    if (to < 0) {
+        fprintf(stderr, "No se pudo escribir '%s': %s\n", output_path, strerror(errno));
+        close(from);
+        return false;
+    }
+    if (executable) fchmod(to, 0755);
+    bool ok = copy_fd(from, to);
+    close(from);
+    if (close(to) != 0) ok = false;
+    if (!ok) unlink(output_path);
+    return ok;
+}
+
+// Crea <dir>/<xx>/ y un temporal junto a la entrada; retorna su descriptor
+static int open_entry_temp(const char* entry_path, char** temp_path) {
+    char* dir = strdup(entry_path);
+    char* slash = strrchr(dir, '/');
+    if (slash) {
+        *slash = '\0';
+        char* parent = strrchr(dir, '/');
+        if (parent) {
+            *parent = '\0';
+            mkdir(dir, 0755);
+            *parent = '/';
+        }
+        mkdir(dir, 0755);
+    }
+    free(dir);
+
+    size_t size = strlen(entry_path) + 8;
+    *temp_path = malloc(size);
+    snprintf(*temp_path, size, "%s.XXXXXX", entry_path);
+    int fd = mkstemp(*temp_path);
+    if (fd < 0) {
+        LOG_WARN(LOG_CAT_DRIVER, "No se pudo crear una entrada en la cache '%s': %s\n", entry_path, strerror(errno));
+        free(*temp_path);
+        *temp_path = NULL;
+    }
+    return fd;
+}
+
+static bool commit_entry(int fd, char* temp_path, const char* entry_path, bool ok) {
+    if (close(fd) != 0) ok = false;
+    if (ok && rename(temp_path, entry_path) != 0) {
+        LOG_WARN(LOG_CAT_DRIVER, "No se pudo guardar '%s' en la cache: %s\n", entry_path, strerror(errno));
+        ok = false;
+    }
+    if (!ok) unlink(temp_path);
+    free(temp_path);
+    return ok;
+}
+
+bool compile_cache_store_file(const char* entry_path, const char* artifact_path) {
+    int from = open(artifact_path, O_RDONLY);
+    if (from < 0) return false;
+
+    char* temp_path = NULL;
+    int to = open_entry_temp(entry_path, &temp_path);
+    if (to < 0) {
+        close(from);
+        return false;
+    }
+    bool ok = copy_fd(from, to);
+    close(from);
+    return commit_entry(to, temp_path, entry_path, ok);
+}
+
+bool compile_cache_store_buffer(const char* entry_path, const void* data, size_t size) {
+    char* temp_path = NULL;
+    int fd = open_entry_temp(entry_path, &temp_path);
+    if (fd < 0) return false;
+
+    const char* bytes = data;
+    bool ok = true;
+    while (size > 0) {
+        ssize_t w = write(fd, bytes, size);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            ok = false;
+            break;
+        }
+        bytes += w;
+        size -= (size_t)w;
+    }
+    return commit_entry(fd, temp_path, entry_path, ok);
+}
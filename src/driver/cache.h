@@ -0,0 +1,31 @@
+#ifndef DRIVER_CACHE_H
+#define DRIVER_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "options.h"
+
+// SHA-256 en hexadecimal mas el terminador
+#define COMPILE_CACHE_KEY_SIZE 65
+
+// Cache de compilacion direccionada por contenido: la clave es el hash de la
+// fuente, el build del compilador (HULK_BUILD_ID, el hash de sus fuentes que
+// genera el Makefile), la version de LLVM, el target y las opciones que
+// afectan a la salida. Cada entrada es el artefacto final (o el bitcode
+// optimizado con --run) en <dir>/<2 primeros hex>/<resto>.<ext>.
+
+// Calcula la clave de la compilacion de 'source' con 'options'
+void compile_cache_key(const char* source, size_t size, const CompilerOptions* options, char key[COMPILE_CACHE_KEY_SIZE]);
+
+// Ruta de la entrada para 'key' (memoria del llamador)
+char* compile_cache_entry_path(const char* cache_dir, const char* key, const CompilerOptions* options);
+
+// Copia la entrada en output_path. Retorna false si no existe (fallo de cache).
+bool compile_cache_fetch(const char* entry_path, const char* output_path, bool executable);
+
+// Guardan una entrada de forma atomica (archivo temporal + rename), de modo que
+// varias compilaciones concurrentes pueden compartir el directorio.
+bool compile_cache_store_file(const char* entry_path, const char* artifact_path);
+bool compile_cache_store_buffer(const char* entry_path, const void* data, size_t size);
+
+#endif // DRIVER_CACHE_H
@@ -0,0 +1,280 @@
+#include "compiler.h"
+#include <stdlib.h>
+#include "generator.h"
+#include "common/common.h"
+#include "ast/ast.h"
+#include "ast/ast_snapshot.h"
+#include "semantic_check/semantic_visitor.h"
+#include "semantic_check/resolve_bindings.h"
+#include "scope/function.h"
+#include "optimizer.h"
+#include "target.h"
+#include "emitter.h"
+#include "jit.h"
+#include "log.h"
+#include "common/context.h"
+#include "cache.h"
+#include <llvm-c/BitReader.h>
+#include <llvm-c/BitWriter.h>
+
+void load_compiler_prelude(CompilerPrelude* prelude) {
+    // Los nombres del prelude se internan antes que los de cualquier programa
+    intern_init();
+    prelude->type_table = create_type_table();
+
+    // Registrar tipos predefinidos
+    register_builtin_types(prelude->type_table);
+    LOG_INFO(LOG_CAT_DRIVER, "Se han cargado %d tipos builtin en la tabla de tipos.\n", prelude->type_table->count);
+
+    // Registrar funciones predefinidas
+    prelude->global_scope = create_symbol_table(NULL);
+    register_predefined_functions(prelude->global_scope, prelude->type_table);
+}
+
+void free_compiler_prelude(CompilerPrelude* prelude) {
+    free_global_scope(prelude->global_scope, prelude->global_scope->size);
+    free_type_table(prelude->type_table);
+    prelude->global_scope = NULL;
+    prelude->type_table = NULL;
+}
+
+// Guarda el bitcode optimizado en la cache antes de que el JIT tome el modulo
+static void store_module_in_cache(LLVMModuleRef module, const char* cache_entry) {
+    LLVMMemoryBufferRef bitcode = LLVMWriteBitcodeToMemoryBuffer(module);
+    compile_cache_store_buffer(cache_entry, LLVMGetBufferStart(bitcode), LLVMGetBufferSize(bitcode));
+    LLVMDisposeMemoryBuffer(bitcode);
+}
+
+// Genera, optimiza y emite (o ejecuta) un programa ya chequeado.
+// cache_entry (opcional) es donde se guarda el artefacto si la compilacion tiene exito
+static int generate_program(ProgramNode* program, const CompilerOptions* options, CompilationContext* ctx, const char* cache_entry, TimeReport* report) {
+    TypeTable* type_table = ctx->type_table;
+
+    // Generación de código LLVM (con --run el modulo se crea en el contexto que usara el JIT)
+    time_report_begin(report, "codegen");
+    LLVMOrcThreadSafeContextRef jit_context = options->run ? LLVMOrcCreateNewThreadSafeContext() : NULL;
+    LLVMCodeGenerator* generator = options->run
+        ? create_llvm_code_generator_in_context("hulk_module", type_table, LLVMOrcThreadSafeContextGetContext(jit_context))
+        : create_llvm_code_generator("hulk_module", type_table);
+    LLVMCodeGenOptLevel codegen_level = codegen_opt_level(options->optimization.level);
+    LLVMTargetMachineRef target_machine = create_host_target_machine(codegen_level);
+    configure_module_target(generator->module, target_machine);
+    LLVMModuleRef module = generate_code(program, generator);
+    report->llvm_instructions = count_llvm_instructions(module);
+
+    // Optimizacion
+    bool ok = module != NULL;
+    if (!ok)
+        fprintf(stderr, "La generacion de codigo LLVM fallo.\n");
+    else {
+        time_report_begin(report, "optimize");
+        ok = optimize_module(module, target_machine, &options->optimization);
+        report->llvm_instructions_optimized = count_llvm_instructions(module);
+    }
+
+    int exit_code = ok ? 0 : 1;
+    if (ok && options->run) {
+        if (cache_entry)
+            store_module_in_cache(module, cache_entry);
+
+        // El JIT pasa a ser dueño del modulo y del contexto
+        generator->module = NULL;
+        destroy_llvm_code_generator(generator);
+        generator = NULL;
+        time_report_begin(report, "jit");
+        ok = run_module_in_jit(module, jit_context, create_host_target_machine(codegen_level), &exit_code);
+        jit_context = NULL;
+        if (!ok) exit_code = 1;
+    } else if (ok) {
+        // Emitir la salida
+        time_report_begin(report, "emit");
+        ok = emit_module(module, target_machine, options->emit_kind, options->output_path);
+        if (ok) {
+            fprintf(stderr, "Archivo '%s' generado exitosamente.\n", options->output_path);
+            if (cache_entry)
+                compile_cache_store_file(cache_entry, options->output_path);
+        } else
+            exit_code = 1;
+    }
+
+    destroy_llvm_code_generator(generator);
+    if (jit_context)
+        LLVMOrcDisposeThreadSafeContext(jit_context);
+    LLVMDisposeTargetMachine(target_machine);
+    time_report_end(report);
+
+    return exit_code;
+}
+
+static int compile_in_context(SourceBuffer* source, const CompilerOptions* options, CompilationContext* ctx, const char* cache_entry, TimeReport* report) {
+    TypeTable* type_table = ctx->type_table;
+    int base_type_count = type_table->count;
+    int base_symbol_count = ctx->global_scope->size;
+
+    // Parsear la entrada
+    time_report_begin(report, "parse");
+    int parse_result = parse_hulk_program(source, ctx);
+    time_report_end(report);
+    if (parse_result != 0)
+        return 1;
+
+    ASTNode* root_node = ctx->root_node;
+    if (root_node == NULL) {
+        fprintf(stderr, "El AST está vacío. No se generará código LLVM.\n");
+        return 1;
+    }
+
+    // Chequeo Semantico
+    time_report_begin(report, "semantic");
+    SemanticVisitor* visitor = init_semantic_visitor(type_table, ctx);
+    semantic_visit(visitor, root_node, ctx->global_scope);
+    int error_count = visitor->error_count;
+    free(visitor);
+    if (error_count == 0)
+        resolve_bindings((ProgramNode*)root_node);
+    time_report_end(report);
+
+    LOG_INFO(LOG_CAT_DRIVER, "Chequeo semántico completado.\n");
+    if (error_count > 0) {
+        fprintf(stderr, "Se encontraron %d errores semánticos. Compilación abortada.\n", error_count);
+        return 1;
+    }
+    if (LOG_ENABLED(LOG_CAT_PARSER, LOG_LEVEL_DEBUG))
+        print_ast_node(root_node, 0); // Imprimir el AST para depuración
+
+    // Guardar el AST chequeado para compilarlo despues con --load-ast
+    if (options->emit_ast_path) {
+        time_report_begin(report, "emit-ast");
+        bool saved = ast_snapshot_write(options->emit_ast_path, (ProgramNode*)root_node, ctx, ctx->global_scope, base_type_count, base_symbol_count);
+        time_report_end(report);
+        if (!saved)
+            return 1;
+        LOG_INFO(LOG_CAT_DRIVER, "Snapshot de AST guardado en '%s'.\n", options->emit_ast_path);
+    }
+
+    return generate_program((ProgramNode*)root_node, options, ctx, cache_entry, report);
+}
+
+// Todo el estado de una compilacion vive en ctx, sobre una copia del prelude
+static void begin_compilation(CompilationContext* ctx, const char* file_name, const CompilerPrelude* prelude) {
+    TypeTable* type_table = copy_type_table(prelude->type_table);
+    init_compilation_context(ctx, type_table, file_name);
+    ctx->global_scope = copy_predefined_functions(prelude->global_scope, type_table);
+    ctx->symbol_count = ctx->global_scope->size;
+    ctx->global_scope->symbol_counter = &ctx->symbol_count;
+}
+
+static void end_compilation(CompilationContext* ctx, const CompilerPrelude* prelude, TimeReport* report) {
+    report->ast_nodes = ctx->ast_node_count;
+    report->symbols = ctx->symbol_count;
+    report->types = ctx->type_table->count;
+
+    // Los scopes de funciones, tipos y let cuelgan del scope global y se van con el
+    free_global_scope(ctx->global_scope, prelude->global_scope->size);
+    free_type_table(ctx->type_table);
+    ctx->global_scope = NULL;
+    ctx->type_table = NULL;
+
+    // El AST vive en la arena del contexto: se libera entero, haya fallado o no
+    free_compilation_context(ctx);
+}
+
+// Argumentos de compile_in_context, para correrla con run_guarded
+typedef struct SourceCompilation {
+    SourceBuffer* source;
+    const CompilerOptions* options;
+    CompilationContext* ctx;
+    const char* cache_entry;
+    TimeReport* report;
+} SourceCompilation;
+
+static int run_source_compilation(void* arg) {
+    SourceCompilation* c = arg;
+    return compile_in_context(c->source, c->options, c->ctx, c->cache_entry, c->report);
+}
+
+static int compile_source(SourceBuffer* source, const CompilerOptions* options, const CompilerPrelude* prelude, const char* cache_entry, TimeReport* report) {
+    CompilationContext ctx;
+    begin_compilation(&ctx, options->input_path ? options->input_path : "<stdin>", prelude);
+
+    // Un error fatal corta solo esta compilacion: el contexto se libera igual y el
+    // hilo (por ejemplo un worker de batch) puede seguir con otro archivo
+    SourceCompilation compilation = { source, options, &ctx, cache_entry, report };
+    int exit_code = run_guarded(run_source_compilation, &compilation);
+    time_report_end(report);    // Por si el error dejo una fase abierta
+
+    end_compilation(&ctx, prelude, report);
+    return exit_code;
+}
+
+int compile_snapshot(const CompilerOptions* options, const CompilerPrelude* prelude, TimeReport* report) {
+    CompilationContext ctx;
+    begin_compilation(&ctx, options->load_ast_path, prelude);
+
+    // Sin parseo ni chequeo semantico: el snapshot ya trae el AST con sus tipos y scopes
+    time_report_begin(report, "load-ast");
+    bool loaded = ast_snapshot_load(options->load_ast_path, &ctx, ctx.global_scope);
+    if (loaded)
+        resolve_bindings((ProgramNode*)ctx.root_node);
+    time_report_end(report);
+
+    int exit_code = loaded ? generate_program((ProgramNode*)ctx.root_node, options, &ctx, NULL, report) : 1;
+    end_compilation(&ctx, prelude, report);
+    return exit_code;
+}
+
+// Ejecuta con el JIT el bitcode de una entrada de la cache. Retorna false si la entrada no existe.
+static bool run_cached_module(const char* cache_entry, const CompilerOptions* options, int* exit_code, TimeReport* report) {
+    LLVMMemoryBufferRef bitcode = NULL;
+    char* error = NULL;
+    if (LLVMCreateMemoryBufferWithContentsOfFile(cache_entry, &bitcode, &error) != 0) {
+        LLVMDisposeMessage(error);
+        return false;
+    }
+
+    LLVMOrcThreadSafeContextRef jit_context = LLVMOrcCreateNewThreadSafeContext();
+    LLVMModuleRef module = NULL;
+    bool parsed = LLVMParseBitcodeInContext2(LLVMOrcThreadSafeContextGetContext(jit_context), bitcode, &module) == 0;
+    LLVMDisposeMemoryBuffer(bitcode);
+    if (!parsed) {
+        LOG_WARN(LOG_CAT_DRIVER, "Entrada de cache corrupta '%s', se recompila.\n", cache_entry);
+        LLVMOrcDisposeThreadSafeContext(jit_context);
+        return false;
+    }
+
+    time_report_begin(report, "jit");
+    LLVMTargetMachineRef target_machine = create_host_target_machine(codegen_opt_level(options->optimization.level));
+    if (!run_module_in_jit(module, jit_context, target_machine, exit_code))
+        *exit_code = 1;
+    return true;
+}
+
+int compile_program(SourceBuffer* source, const CompilerOptions* options, const CompilerPrelude* prelude, TimeReport* report) {
+    // Un acierto de cache no pasaria por el chequeo y no podria escribir el snapshot
+    if (!options->cache_dir || options->emit_ast_path)
+        return compile_source(source, options, prelude, NULL, report);
+
+    time_report_begin(report, "cache");
+    char key[COMPILE_CACHE_KEY_SIZE];
+    compile_cache_key(source->data, source->size, options, key);
+    char* cache_entry = compile_cache_entry_path(options->cache_dir, key, options);
+
+    // Con un acierto no se parsea, no se chequea ni se genera codigo
+    int exit_code = 0;
+    bool hit = options->run
+        ? run_cached_module(cache_entry, options, &exit_code, report)
+        : compile_cache_fetch(cache_entry, options->output_path, options->emit_kind == EMIT_EXECUTABLE);
+    time_report_end(report);
+
+    if (hit) {
+        LOG_INFO(LOG_CAT_DRIVER, "Acierto de cache %s\n", key);
+        if (!options->run)
+            fprintf(stderr, "Archivo '%s' generado exitosamente.\n", options->output_path);
+    } else {
+        LOG_INFO(LOG_CAT_DRIVER, "Fallo de cache %s\n", key);
+        exit_code = compile_source(source, options, prelude, cache_entry, report);
+    }
+
+    free(cache_entry);
+    return exit_code;
+}
@@ -0,0 +1,29 @@
+#ifndef DRIVER_COMPILER_H
+#define DRIVER_COMPILER_H
+
+#include <stdio.h>
+#include "options.h"
+#include "time_report.h"
+#include "hulk_type/type_table.h"
+#include "scope/symbol_table.h"
+#include "common/source.h"
+
+typedef struct CompilerPrelude {
+    // Estado que no depende del programa: tipos builtin y funciones predefinidas.
+    // No se modifica al compilar: cada compilacion trabaja sobre su propia copia,
+    // asi que varias pueden compartir el mismo prelude desde hilos distintos.
+    TypeTable* type_table;
+    SymbolTable* global_scope;
+} CompilerPrelude;
+
+void load_compiler_prelude(CompilerPrelude* prelude);
+void free_compiler_prelude(CompilerPrelude* prelude);
+
+// Ejecuta parseo, chequeo semantico, generacion de codigo, optimizacion y emision
+// (o JIT) sobre 'source', que se escanea en el sitio. Retorna el codigo de salida del compilador.
+int compile_program(SourceBuffer* source, const CompilerOptions* options, const CompilerPrelude* prelude, TimeReport* report);
+
+// Igual que compile_program, pero toma el AST ya chequeado del snapshot options->load_ast_path
+int compile_snapshot(const CompilerOptions* options, const CompilerPrelude* prelude, TimeReport* report);
+
+#endif // DRIVER_COMPILER_H
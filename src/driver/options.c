@@ -0,0 +1,192 @@
+#include "options.h"
+#include "log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void print_usage(const char* program_name) {
+    fprintf(stderr,
+        "Uso: %s [opciones] [archivo.hulk ...]\n"
+        "Opciones:\n"
+        "  -O0 | -O1 | -O2 | -O3 | -Os | -Oz   Nivel de optimizacion (por defecto -O0)\n"
+        "  --passes=<pipeline>                 Pipeline de passes personalizado (ej. \"mem2reg,instcombine,gvn\")\n"
+        "  -o <archivo>                        Archivo de salida (el formato se deduce de la extension)\n"
+        "  -j <N>                              Con varios archivos, compila N en paralelo (por defecto uno por nucleo)\n"
+        "  --emit=llvm|bc|asm|obj|exe          Formato de salida (por defecto llvm en output.ll)\n"
+        "  --run                               Compila en memoria con el JIT y ejecuta el programa\n"
+        "  --server[=<socket>]                 Atiende peticiones de compilacion por stdin/stdout o un socket Unix\n"
+        "  --cache-dir=<dir>                   Reutiliza artefactos de compilaciones identicas (tambien HULK_CACHE_DIR)\n"
+        "  --no-cache                          Ignora la cache de compilacion\n"
+        "  --emit-ast=<archivo.hast>           Guarda el AST ya chequeado en un snapshot binario\n"
+        "  --load-ast=<archivo.hast>           Compila desde un snapshot sin parsear ni chequear la fuente\n"
+        "  -v | -vv | -vvv                     Mensajes de diagnostico (info, debug, trace) en stderr\n"
+        "  --log=<cat>[:nivel],...             Activa el log de driver|parser|semantic|codegen|all (nivel por defecto debug)\n"
+        "  --time-report[=table|json]          Tiempo, memoria y contadores por fase (en stderr)\n"
+        "  -h, --help                          Muestra esta ayuda\n",
+        program_name);
+}
+
+static bool parse_opt_level(const char* arg, OptimizationLevel* level) {
+    if (strcmp(arg, "-O0") == 0) *level = OPT_LEVEL_O0;
+    else if (strcmp(arg, "-O1") == 0) *level = OPT_LEVEL_O1;
+    else if (strcmp(arg, "-O2") == 0 || strcmp(arg, "-O") == 0) *level = OPT_LEVEL_O2;
+    else if (strcmp(arg, "-O3") == 0) *level = OPT_LEVEL_O3;
+    else if (strcmp(arg, "-Os") == 0) *level = OPT_LEVEL_Os;
+    else if (strcmp(arg, "-Oz") == 0) *level = OPT_LEVEL_Oz;
+    else return false;
+    return true;
+}
+
+bool parse_compiler_options(int argc, char** argv, CompilerOptions* options) {
+    options->input_path = NULL;
+    options->input_paths = malloc(sizeof(const char*) * (argc > 1 ? argc : 1));
+    options->input_count = 0;
+    options->jobs = 0;
+    options->optimization.level = OPT_LEVEL_O0;
+    options->optimization.passes = NULL;
+    options->output_path = NULL;
+    options->emit_kind = EMIT_LLVM;
+    options->run = false;
+    options->server = false;
+    options->server_socket = NULL;
+    options->emit_ast_path = NULL;
+    options->load_ast_path = NULL;
+    options->time_report = TIME_REPORT_NONE;
+    const char* env_cache_dir = getenv("HULK_CACHE_DIR");
+    options->cache_dir = env_cache_dir && *env_cache_dir ? env_cache_dir : NULL;
+    bool emit_given = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            print_usage(argv[0]);
+            return false;
+        }
+        if (strncmp(arg, "-O", 2) == 0) {
+            if (!parse_opt_level(arg, &options->optimization.level)) {
+                fprintf(stderr, "Nivel de optimizacion desconocido '%s'\n", arg);
+                return false;
+            }
+            continue;
+        }
+        if (strncmp(arg, "--passes=", 9) == 0) {
+            options->optimization.passes = arg + 9;
+            continue;
+        }
+        if (strcmp(arg, "--run") == 0) {
+            options->run = true;
+            continue;
+        }
+        if (strcmp(arg, "--server") == 0) {
+            options->server = true;
+            continue;
+        }
+        if (strncmp(arg, "--server=", 9) == 0) {
+            options->server = true;
+            options->server_socket = arg + 9;
+            continue;
+        }
+        if (strncmp(arg, "--cache-dir=", 12) == 0) {
+            options->cache_dir = *(arg + 12) ? arg + 12 : NULL;
+            continue;
+        }
+        if (strcmp(arg, "--no-cache") == 0) {
+            options->cache_dir = NULL;
+            continue;
+        }
+        if (strncmp(arg, "--emit-ast=", 11) == 0 || strncmp(arg, "--load-ast=", 11) == 0) {
+            if (!arg[11]) {
+                fprintf(stderr, "Falta el archivo en '%s'\n", arg);
+                return false;
+            }
+            if (arg[2] == 'e') options->emit_ast_path = arg + 11;
+            else options->load_ast_path = arg + 11;
+            continue;
+        }
+        if (strcmp(arg, "-v") == 0 || strcmp(arg, "-vv") == 0 || strcmp(arg, "-vvv") == 0) {
+            log_set_verbosity((int)strlen(arg) - 1);
+            continue;
+        }
+        if (strncmp(arg, "--log=", 6) == 0) {
+            if (!log_configure(arg + 6))
+                return false;
+            continue;
+        }
+        if (strcmp(arg, "--time-report") == 0) {
+            options->time_report = TIME_REPORT_TABLE;
+            continue;
+        }
+        if (strncmp(arg, "--time-report=", 14) == 0) {
+            if (!parse_time_report_format(arg + 14, &options->time_report)) {
+                fprintf(stderr, "Formato de reporte desconocido '%s'\n", arg + 14);
+                return false;
+            }
+            continue;
+        }
+        if (strncmp(arg, "-j", 2) == 0) {
+            const char* value = arg[2] ? arg + 2 : (i + 1 < argc ? argv[++i] : NULL);
+            char* end = NULL;
+            long jobs = value ? strtol(value, &end, 10) : 0;
+            if (!value || *end != '\0' || jobs < 1) {
+                fprintf(stderr, "Numero de trabajos invalido para '-j'\n");
+                return false;
+            }
+            options->jobs = (int)jobs;
+            continue;
+        }
+        if (strcmp(arg, "-o") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Falta el archivo de salida despues de '-o'\n");
+                return false;
+            }
+            options->output_path = argv[++i];
+            continue;
+        }
+        if (strncmp(arg, "--emit=", 7) == 0) {
+            if (!parse_emit_kind(arg + 7, &options->emit_kind)) {
+                fprintf(stderr, "Formato de salida desconocido '%s'\n", arg + 7);
+                return false;
+            }
+            emit_given = true;
+            continue;
+        }
+        if (arg[0] == '-' && arg[1] != '\0') {
+            fprintf(stderr, "Opcion desconocida '%s'\n", arg);
+            print_usage(argv[0]);
+            return false;
+        }
+        if (!options->input_path)
+            options->input_path = arg;
+        options->input_paths[options->input_count++] = arg;
+    }
+
+    // Con varios archivos cada salida se nombra a partir de su fuente
+    if (options->input_count > 1 && (options->output_path || options->run)) {
+        fprintf(stderr, "'-o' y '--run' solo admiten un archivo de entrada\n");
+        return false;
+    }
+
+    // Los snapshots de AST son de un solo programa y se leen o escriben en el host
+    if ((options->emit_ast_path || options->load_ast_path) && (options->input_count > 1 || options->server)) {
+        fprintf(stderr, "'--emit-ast' y '--load-ast' solo admiten un archivo de entrada y no funcionan con '--server'\n");
+        return false;
+    }
+    if (options->load_ast_path && (options->input_path || options->emit_ast_path)) {
+        fprintf(stderr, "'--load-ast' reemplaza al archivo de entrada y no se combina con '--emit-ast'\n");
+        return false;
+    }
+
+    // Sin --emit el formato se deduce de -o; sin -o se usa el nombre por defecto del formato
+    if (options->output_path && !emit_given)
+        options->emit_kind = emit_kind_from_path(options->output_path);
+    if (!options->output_path)
+        options->output_path = default_output_path(options->emit_kind);
+    return true;
+}
+
+void free_compiler_options(CompilerOptions* options) {
+    free(options->input_paths);
+    options->input_paths = NULL;
+    options->input_count = 0;
+}
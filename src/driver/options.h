@@ -0,0 +1,32 @@
+#ifndef DRIVER_OPTIONS_H
+#define DRIVER_OPTIONS_H
+
+#include <stdbool.h>
+#include "optimizer.h"
+#include "emitter.h"
+#include "time_report.h"
+
+typedef struct CompilerOptions {
+    const char* input_path;             // Archivo fuente (NULL para leer de stdin)
+    const char** input_paths;           // Todos los archivos fuente (compilacion por lotes si hay mas de uno)
+    int input_count;
+    int jobs;                           // Compilaciones en paralelo por lotes (-j, 0 = un worker por nucleo)
+    const char* output_path;            // Archivo de salida (-o)
+    EmitKind emit_kind;                 // Formato de salida (--emit)
+    bool run;                           // Ejecutar main con el JIT en lugar de emitir (--run)
+    bool server;                        // Modo servidor de compilacion (--server)
+    const char* server_socket;          // Socket Unix del servidor (NULL para stdin/stdout)
+    const char* cache_dir;              // Cache de compilacion (--cache-dir o HULK_CACHE_DIR, NULL si esta desactivada)
+    const char* emit_ast_path;          // Guarda el AST chequeado en un snapshot (--emit-ast)
+    const char* load_ast_path;          // Compila desde un snapshot en lugar de una fuente (--load-ast)
+    TimeReportFormat time_report;       // Reporte de tiempos por fase (--time-report)
+    OptimizationOptions optimization;   // Nivel de optimizacion y pipeline personalizado
+} CompilerOptions;
+
+// Parsea la linea de comandos. Retorna false si algun argumento es invalido.
+bool parse_compiler_options(int argc, char** argv, CompilerOptions* options);
+// Libera lo que reserva parse_compiler_options (tambien si fallo)
+void free_compiler_options(CompilerOptions* options);
+void print_usage(const char* program_name);
+
+#endif // DRIVER_OPTIONS_H
@@ -0,0 +1,261 @@
+#include "server.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "compiler.h"
+#include "target.h"
+#include "log.h"
+
+#define MAX_REQUEST_ARGS 64
+
+typedef struct CompileServer {
+    const char* program_name;
+    CompilerPrelude prelude;    // Cargado una sola vez; cada hijo hereda una copia
+} CompileServer;
+
+static void send_response(FILE* out, const char* status, const char* data, size_t size) {
+    fprintf(out, "%s %zu\n", status, size);
+    if (size > 0)
+        fwrite(data, 1, size, out);
+    fflush(out);
+}
+
+static char* read_whole_file(FILE* file, size_t* size) {
+    fflush(file);
+    if (fseek(file, 0, SEEK_END) != 0) return NULL;
+    long length = ftell(file);
+    rewind(file);
+    if (length < 0) return NULL;
+
+    char* data = malloc((size_t)length + 1);
+    if (!data) return NULL;
+    *size = fread(data, 1, (size_t)length, file);
+    return data;
+}
+
+static char* make_temp_output(void) {
+    const char* tmpdir = getenv("TMPDIR");
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/hulk-server-XXXXXX", tmpdir && *tmpdir ? tmpdir : "/tmp");
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return NULL;
+    close(fd);
+    return strdup(path);
+}
+
+// Proceso hijo: parsea las opciones de la peticion y compila la fuente en output_path.
+// stdout y stderr ya apuntan al archivo de diagnosticos.
+static int compile_request(CompileServer* server, char* args, char* source, size_t size, const char* output_path) {
+    char* argv[MAX_REQUEST_ARGS + 2];
+    int argc = 0;
+    argv[argc++] = (char*)server->program_name;
+    argv[argc++] = "--emit=obj"; // Por defecto se devuelve codigo objeto; la peticion puede cambiarlo
+
+    for (char* tok = strtok(args, " \t"); tok; tok = strtok(NULL, " \t")) {
+        if (argc >= MAX_REQUEST_ARGS + 2) {
+            fprintf(stderr, "Demasiadas opciones en la peticion\n");
+            return 1;
+        }
+        argv[argc++] = tok;
+    }
+
+    CompilerOptions options;
+    bool valid = parse_compiler_options(argc, argv, &options);
+    if (valid && (options.run || options.input_path)) {
+        fprintf(stderr, "En modo servidor la fuente viaja en la peticion; no se admiten archivos de entrada ni --run\n");
+        valid = false;
+    }
+    if (valid && (options.emit_ast_path || options.load_ast_path)) {
+        fprintf(stderr, "En modo servidor no se admiten '--emit-ast' ni '--load-ast'\n");
+        valid = false;
+    }
+    if (!valid) {
+        free_compiler_options(&options);
+        return 1;
+    }
+    options.output_path = output_path;
+
+    // La fuente de la peticion ya termina en dos '\0' y se escanea en el sitio
+    SourceBuffer buffer;
+    source_buffer_borrow(&buffer, source, size);
+
+    TimeReport report;
+    time_report_init(&report, options.time_report);
+    int exit_code = compile_program(&buffer, &options, &server->prelude, &report);
+    time_report_print(&report, stderr);
+    free_compiler_options(&options);
+    return exit_code;
+}
+
+static void handle_compile(CompileServer* server, FILE* in, FILE* out, char* args, size_t size) {
+    char* source = malloc(size + 2);
+    if (!source || fread(source, 1, size, in) != size) {
+        free(source);
+        const char* msg = "Fuente incompleta en la peticion\n";
+        send_response(out, "error", msg, strlen(msg));
+        return;
+    }
+    source[size] = '\0';
+    source[size + 1] = '\0';
+
+    FILE* diagnostics = tmpfile();
+    char* output_path = make_temp_output();
+    if (!diagnostics || !output_path) {
+        const char* msg = "No se pudieron crear los archivos temporales del servidor\n";
+        send_response(out, "error", msg, strlen(msg));
+        if (diagnostics) fclose(diagnostics);
+        free(output_path);
+        free(source);
+        return;
+    }
+
+    fflush(NULL);
+    pid_t pid = fork();
+    if (pid == 0) {
+        // El canal de peticiones se cambia por /dev/null para que el exit del hijo no
+        // mueva la posicion del archivo que sigue leyendo el padre.
+        int devnull = open("/dev/null", O_RDONLY);
+        if (devnull >= 0) dup2(devnull, fileno(in));
+        dup2(fileno(diagnostics), STDOUT_FILENO);
+        dup2(fileno(diagnostics), STDERR_FILENO);
+        int code = compile_request(server, args, source, size, output_path);
+        fflush(NULL);
+        _exit(code);
+    }
+
+    int status = 0;
+    if (pid < 0)
+        fprintf(diagnostics, "fork fallo: %s\n", strerror(errno));
+    else
+        waitpid(pid, &status, 0);
+
+    bool ok = pid > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if (pid > 0 && WIFSIGNALED(status))
+        fprintf(diagnostics, "El compilador termino por la senal %d (%s)\n", WTERMSIG(status), strsignal(WTERMSIG(status)));
+
+    size_t length = 0;
+    char* payload = NULL;
+    if (ok) {
+        FILE* output = fopen(output_path, "rb");
+        payload = output ? read_whole_file(output, &length) : NULL;
+        if (output) fclose(output);
+        ok = payload != NULL;
+    }
+    if (!ok) {
+        free(payload);
+        payload = read_whole_file(diagnostics, &length);
+    }
+    send_response(out, ok ? "ok" : "error", payload ? payload : "", payload ? length : 0);
+    LOG_DEBUG(LOG_CAT_DRIVER, "Peticion atendida: %s (%zu bytes)\n", ok ? "ok" : "error", length);
+
+    free(payload);
+    fclose(diagnostics);
+    unlink(output_path);
+    free(output_path);
+    free(source);
+}
+
+// Atiende peticiones hasta fin de entrada o 'quit'. Retorna false si se pidio 'quit'.
+static bool serve_stream(CompileServer* server, FILE* in, FILE* out) {
+    char* line = NULL;
+    size_t capacity = 0;
+    bool keep_running = true;
+
+    while (getline(&line, &capacity, in) > 0) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0')
+            continue;
+        if (strcmp(line, "quit") == 0) {
+            keep_running = false;
+            break;
+        }
+
+        char* end = NULL;
+        if (strncmp(line, "compile ", 8) == 0) {
+            errno = 0;
+            unsigned long long size = strtoull(line + 8, &end, 10);
+            if (errno == 0 && end != line + 8 && (*end == '\0' || *end == ' ')) {
+                handle_compile(server, in, out, end, (size_t)size);
+                continue;
+            }
+        }
+        char msg[512];
+        int n = snprintf(msg, sizeof(msg), "Peticion invalida '%.400s' (se esperaba 'compile <bytes> [opciones]' o 'quit')\n", line);
+        send_response(out, "error", msg, (size_t)n);
+        // Sin longitud valida no se puede resincronizar el flujo
+        break;
+    }
+    free(line);
+    return keep_running;
+}
+
+static int serve_socket(CompileServer* server, const char* socket_path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Ruta de socket demasiado larga '%s'\n", socket_path);
+        return 1;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        perror("socket");
+        return 1;
+    }
+    unlink(socket_path);
+    if (bind(listen_fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(listen_fd, 16) != 0) {
+        fprintf(stderr, "No se pudo escuchar en '%s': %s\n", socket_path, strerror(errno));
+        close(listen_fd);
+        return 1;
+    }
+    LOG_INFO(LOG_CAT_DRIVER, "Servidor escuchando en %s\n", socket_path);
+
+    bool keep_running = true;
+    while (keep_running) {
+        int conn = accept(listen_fd, NULL, NULL);
+        if (conn < 0) {
+            if (errno == EINTR) continue;
+            perror("accept");
+            break;
+        }
+        FILE* in = fdopen(conn, "r");
+        FILE* out = fdopen(dup(conn), "w");
+        if (in && out)
+            keep_running = serve_stream(server, in, out);
+        if (in) fclose(in); else close(conn);
+        if (out) fclose(out);
+    }
+
+    close(listen_fd);
+    unlink(socket_path);
+    return 0;
+}
+
+int run_compile_server(const CompilerOptions* options, const char* program_name) {
+    // Un cliente que cierra la conexion no debe tumbar el servidor
+    signal(SIGPIPE, SIG_IGN);
+
+    CompileServer server;
+    server.program_name = program_name;
+    initialize_native_target();
+    load_compiler_prelude(&server.prelude);
+
+    int exit_code = 0;
+    if (options->server_socket)
+        exit_code = serve_socket(&server, options->server_socket);
+    else
+        serve_stream(&server, stdin, stdout);
+
+    free_compiler_prelude(&server.prelude);
+    return exit_code;
+}
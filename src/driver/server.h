@@ -0,0 +1,18 @@
+#ifndef DRIVER_SERVER_H
+#define DRIVER_SERVER_H
+
+#include "options.h"
+
+// Modo servidor (--server[=<socket>]): mantiene cargados el preludio y LLVM y atiende
+// muchas compilaciones. Protocolo por stdin/stdout o por un socket Unix:
+//
+//   peticion:   compile <bytes> [opciones]\n<fuente>      (opciones como en la linea de comandos)
+//               quit\n
+//   respuesta:  ok <bytes>\n<salida>                      (objeto por defecto, o --emit=llvm|bc|asm|obj)
+//               error <bytes>\n<diagnosticos>
+//
+// Cada peticion se compila en un proceso hijo creado con fork, de modo que los errores
+// fatales (exit) y el estado global del parser no afectan al servidor.
+int run_compile_server(const CompilerOptions* options, const char* program_name);
+
+#endif // DRIVER_SERVER_H
@@ -0,0 +1,105 @@
+#include "time_report.h"
+#include <string.h>
+#include <sys/resource.h>
+
+static double elapsed_ms(const struct timespec* start, const struct timespec* end) {
+    return (double)(end->tv_sec - start->tv_sec) * 1e3 + (double)(end->tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static long peak_rss_kb(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return usage.ru_maxrss; // En Linux ru_maxrss viene en KB
+}
+
+void time_report_init(TimeReport* report, TimeReportFormat format) {
+    memset(report, 0, sizeof(*report));
+    report->format = format;
+}
+
+void time_report_begin(TimeReport* report, const char* phase) {
+    if (report->format == TIME_REPORT_NONE)
+        return;
+    if (report->current)
+        time_report_end(report);
+    report->current = phase;
+    clock_gettime(CLOCK_MONOTONIC, &report->wall_start);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &report->cpu_start);
+}
+
+void time_report_end(TimeReport* report) {
+    if (report->format == TIME_REPORT_NONE || !report->current)
+        return;
+
+    struct timespec wall_end, cpu_end;
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+
+    if (report->phase_count < TIME_REPORT_MAX_PHASES) {
+        PhaseTiming* phase = &report->phases[report->phase_count++];
+        phase->name = report->current;
+        phase->wall_ms = elapsed_ms(&report->wall_start, &wall_end);
+        phase->cpu_ms = elapsed_ms(&report->cpu_start, &cpu_end);
+        phase->peak_rss_kb = peak_rss_kb();
+    }
+    report->current = NULL;
+}
+
+static void print_table(const TimeReport* report, FILE* out) {
+    double total_wall = 0, total_cpu = 0;
+    long max_rss = 0;
+
+    fprintf(out, "===== Reporte de tiempos =====\n");
+    fprintf(out, "%-12s %12s %12s %14s\n", "fase", "wall (ms)", "cpu (ms)", "pico RSS (KB)");
+    for (int i = 0; i < report->phase_count; i++) {
+        const PhaseTiming* p = &report->phases[i];
+        fprintf(out, "%-12s %12.3f %12.3f %14ld\n", p->name, p->wall_ms, p->cpu_ms, p->peak_rss_kb);
+        total_wall += p->wall_ms;
+        total_cpu += p->cpu_ms;
+        if (p->peak_rss_kb > max_rss) max_rss = p->peak_rss_kb;
+    }
+    fprintf(out, "%-12s %12.3f %12.3f %14ld\n", "total", total_wall, total_cpu, max_rss);
+    fprintf(out, "nodos AST: %ld  simbolos: %ld  tipos: %ld  instrucciones LLVM: %ld (optimizadas: %ld)\n",
+            report->ast_nodes, report->symbols, report->types,
+            report->llvm_instructions, report->llvm_instructions_optimized);
+}
+
+static void print_json(const TimeReport* report, FILE* out) {
+    fprintf(out, "{\"phases\":[");
+    for (int i = 0; i < report->phase_count; i++) {
+        const PhaseTiming* p = &report->phases[i];
+        fprintf(out, "%s{\"name\":\"%s\",\"wall_ms\":%.3f,\"cpu_ms\":%.3f,\"peak_rss_kb\":%ld}",
+                i ? "," : "", p->name, p->wall_ms, p->cpu_ms, p->peak_rss_kb);
+    }
+    fprintf(out, "],\"counts\":{\"ast_nodes\":%ld,\"symbols\":%ld,\"types\":%ld,"
+                 "\"llvm_instructions\":%ld,\"llvm_instructions_optimized\":%ld}}\n",
+            report->ast_nodes, report->symbols, report->types,
+            report->llvm_instructions, report->llvm_instructions_optimized);
+}
+
+void time_report_print(const TimeReport* report, FILE* out) {
+    switch (report->format) {
+        case TIME_REPORT_TABLE: print_table(report, out); break;
+        case TIME_REPORT_JSON: print_json(report, out); break;
+        default: break;
+    }
+}
+
+bool parse_time_report_format(const char* name, TimeReportFormat* format) {
+    if (strcmp(name, "table") == 0) *format = TIME_REPORT_TABLE;
+    else if (strcmp(name, "json") == 0) *format = TIME_REPORT_JSON;
+    else return false;
+    return true;
+}
+
+long count_llvm_instructions(LLVMModuleRef module) {
+    long count = 0;
+    if (!module)
+        return 0;
+    for (LLVMValueRef fn = LLVMGetFirstFunction(module); fn; fn = LLVMGetNextFunction(fn))
+        for (LLVMBasicBlockRef bb = LLVMGetFirstBasicBlock(fn); bb; bb = LLVMGetNextBasicBlock(bb))
+            for (LLVMValueRef inst = LLVMGetFirstInstruction(bb); inst; inst = LLVMGetNextInstruction(inst))
+                count++;
+    return count;
+}
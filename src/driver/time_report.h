@@ -0,0 +1,51 @@
+#ifndef DRIVER_TIME_REPORT_H
+#define DRIVER_TIME_REPORT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <time.h>
+#include <llvm-c/Core.h>
+
+#define TIME_REPORT_MAX_PHASES 16
+
+typedef enum TimeReportFormat {
+    TIME_REPORT_NONE,
+    TIME_REPORT_TABLE,
+    TIME_REPORT_JSON
+} TimeReportFormat;
+
+typedef struct PhaseTiming {
+    const char* name;
+    double wall_ms;         // Tiempo real de la fase
+    double cpu_ms;          // Tiempo de CPU del hilo que compila durante la fase
+    long peak_rss_kb;       // Pico de memoria residente del proceso al terminar la fase
+} PhaseTiming;
+
+typedef struct TimeReport {
+    TimeReportFormat format;
+    PhaseTiming phases[TIME_REPORT_MAX_PHASES];
+    int phase_count;
+
+    // Fase en curso
+    const char* current;
+    struct timespec wall_start;
+    struct timespec cpu_start;
+
+    // Contadores del programa compilado
+    long ast_nodes;
+    long symbols;
+    long types;
+    long llvm_instructions;             // Tras la generacion de codigo
+    long llvm_instructions_optimized;   // Tras el pipeline de optimizacion
+} TimeReport;
+
+void time_report_init(TimeReport* report, TimeReportFormat format);
+// Marca el inicio y el fin de una fase. Sin formato no mide nada.
+void time_report_begin(TimeReport* report, const char* phase);
+void time_report_end(TimeReport* report);
+void time_report_print(const TimeReport* report, FILE* out);
+
+bool parse_time_report_format(const char* name, TimeReportFormat* format);
+long count_llvm_instructions(LLVMModuleRef module);
+
+#endif // DRIVER_TIME_REPORT_H
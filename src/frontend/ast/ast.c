@@ -1,7 +1,6 @@
 #include "ast.h"
 #include "../common/common.h"
 #include "../hulk_type/type_table.h"
-#include "../../backend/codegen/ast_accept.h"
 
 const char *Hulk_Op_Names[] = {
     [AND_TK] = "AND", [OR_TK] = "OR", [NOT_TK] = "NOT",
@@ -12,59 +11,57 @@ const char *Hulk_Op_Names[] = {
     [LE_TK] = "LE", [EQ_TK] = "EQ", [NE_TK] = "NE",
 };
 
-void create_ast_base(ASTNode* base, ASTNodeType type, TypeDescriptor* return_type) {
+void create_ast_base(ASTNode* base, ASTNodeType type, TypeDescriptor* return_type, CompilationContext* ctx) {
     base->type = type;
     base->return_type = return_type;
-    base->accept = generic_ast_accept;
-    base->line = line_num;
-     base->line_text = strdup(current_line);
+    base->id = context_add_node_loc(ctx, ctx->loc);
 }
 
-ASTNode* create_number_literal_node(double value, TypeTable *table) {
-    LiteralNode *node = malloc(sizeof(LiteralNode));
+ASTNode* create_number_literal_node(double value, CompilationContext* ctx) {
+    LiteralNode *node = arena_alloc(&ctx->arena, sizeof(LiteralNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Literal, type_table_lookup(table, "Number"));
+    create_ast_base(&node->base, AST_Node_Literal, ctx->builtins->number, ctx);
     node->value.number_value = value;
 
     return (ASTNode*) node;
 }
 
-ASTNode* create_string_literal_node(char *value, TypeTable *table) {
-    LiteralNode *node = malloc(sizeof(LiteralNode));
+ASTNode* create_string_literal_node(char *value, CompilationContext* ctx) {
+    LiteralNode *node = arena_alloc(&ctx->arena, sizeof(LiteralNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Literal, type_table_lookup(table, "String"));
-    node->value.string_value = strdup(value); 
+    create_ast_base(&node->base, AST_Node_Literal, ctx->builtins->string, ctx);
+    node->value.string_value = value; 
 
     return (ASTNode*) node;
 }
 
-ASTNode* create_bool_literal_node(int value, TypeTable *table) {
-    LiteralNode *node = malloc(sizeof(LiteralNode));
+ASTNode* create_bool_literal_node(int value, CompilationContext* ctx) {
+    LiteralNode *node = arena_alloc(&ctx->arena, sizeof(LiteralNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Literal, type_table_lookup(table, "Bool"));
+    create_ast_base(&node->base, AST_Node_Literal, ctx->builtins->boolean, ctx);
     node->value.bool_value = value != 0; // asegurar 0 o 1
 
     return (ASTNode*) node;
 }
-ASTNode* create_unary_operation_node(HULK_Op operator, ASTNode *operand, TypeTable *table) {
-    UnaryOperationNode *node = malloc(sizeof(UnaryOperationNode));
+ASTNode* create_unary_operation_node(HULK_Op operator, ASTNode *operand, CompilationContext* ctx) {
+    UnaryOperationNode *node = arena_alloc(&ctx->arena, sizeof(UnaryOperationNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Unary_Operation, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_Unary_Operation, ctx->builtins->undefined, ctx);
     node->operator = operator;
     node->operand = operand;
 
     return (ASTNode*) node;
 }
 
-ASTNode* create_binary_operation_node(HULK_Op operator, ASTNode *left, ASTNode *right, TypeTable *table) {
-    BinaryOperationNode *node = malloc(sizeof(BinaryOperationNode));
+ASTNode* create_binary_operation_node(HULK_Op operator, ASTNode *left, ASTNode *right, CompilationContext* ctx) {
+    BinaryOperationNode *node = arena_alloc(&ctx->arena, sizeof(BinaryOperationNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Binary_Operation, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_Binary_Operation, ctx->builtins->undefined, ctx);
     node->operator = operator;
     node->left = left;
     node->right = right;
@@ -72,14 +69,14 @@ ASTNode* create_binary_operation_node(HULK_Op operator, ASTNode *left, ASTNode *
     return (ASTNode*) node;
 }
 
-ASTNode* create_expression_block_node(ASTNode **expressions, int count, TypeTable *table) {
-    ExpressionBlockNode *node = malloc(sizeof(ExpressionBlockNode));
+ASTNode* create_expression_block_node(ASTNode **expressions, int count, CompilationContext* ctx) {
+    ExpressionBlockNode *node = arena_alloc(&ctx->arena, sizeof(ExpressionBlockNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Expression_Block, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_Expression_Block, ctx->builtins->undefined, ctx);
     
     // do not assign the array, copy each expression
-    node->expressions = malloc(sizeof(ASTNode*) * count);
+    node->expressions = arena_alloc(&ctx->arena, sizeof(ASTNode*) * count);
     
     for (int i = 0; i < count; i++) {
         node->expressions[i] = expressions[i]; // copy the pointer
@@ -89,11 +86,11 @@ ASTNode* create_expression_block_node(ASTNode **expressions, int count, TypeTabl
     return (ASTNode*) node;
 }
 
-ASTNode* create_conditional_node(ASTNode *condition, ASTNode *then_branch, ASTNode *else_branch, TypeTable *table) {
-    ConditionalNode *node = malloc(sizeof(ConditionalNode));
+ASTNode* create_conditional_node(ASTNode *condition, ASTNode *then_branch, ASTNode *else_branch, CompilationContext* ctx) {
+    ConditionalNode *node = arena_alloc(&ctx->arena, sizeof(ConditionalNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Conditional, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_Conditional, ctx->builtins->undefined, ctx);
     node->condition = condition;
     node->then_branch = then_branch;
     node->else_branch = else_branch;
@@ -101,11 +98,11 @@ ASTNode* create_conditional_node(ASTNode *condition, ASTNode *then_branch, ASTNo
     return (ASTNode*) node;
 }
 
-ASTNode* create_while_loop_node(ASTNode *condition, ASTNode *body, TypeTable *table) {
-    WhileLoopNode *node = malloc(sizeof(WhileLoopNode));
+ASTNode* create_while_loop_node(ASTNode *condition, ASTNode *body, CompilationContext* ctx) {
+    WhileLoopNode *node = arena_alloc(&ctx->arena, sizeof(WhileLoopNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_While_Loop, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_While_Loop, ctx->builtins->undefined, ctx);
 
     node->condition = condition;
     node->body = body;
@@ -113,29 +110,26 @@ ASTNode* create_while_loop_node(ASTNode *condition, ASTNode *body, TypeTable *ta
     return (ASTNode*) node;
 }
 
-ASTNode* create_variable_assigment_node(VariableAssigment* assigment, TypeTable* table) {
-    VariableAssigmentNode* node = malloc(sizeof(VariableAssigmentNode));
+ASTNode* create_variable_assigment_node(VariableAssigment* assigment, CompilationContext* ctx) {
+    VariableAssigmentNode* node = arena_alloc(&ctx->arena, sizeof(VariableAssigmentNode));
     if(!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Variable_Assigment, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_Variable_Assigment, ctx->builtins->undefined, ctx);
     node->scope = NULL;
     node->assigment = assigment;
 
     return (ASTNode*) node;
 }
 
-ASTNode* create_let_in_node(VariableAssigmentNode** assigments, int assigment_count, ASTNode* body, TypeTable* table) {
-    LetInNode* node = malloc(sizeof(LetInNode));
+ASTNode* create_let_in_node(VariableAssigmentNode** assigments, int assigment_count, ASTNode* body, CompilationContext* ctx) {
+    LetInNode* node = arena_alloc(&ctx->arena, sizeof(LetInNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Let_In, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_Let_In, ctx->builtins->undefined, ctx);
     node->scope = NULL;
 
-    node->assigments = malloc(sizeof(VariableAssigmentNode*) * assigment_count);
-    if (!node->assigments) {
-        free(node);
-        return NULL;
-    }
+    node->assigments = arena_alloc(&ctx->arena, sizeof(VariableAssigmentNode*) * assigment_count);
+    if (!node->assigments) return NULL;
 
     for (int i = 0; i < assigment_count; i++) {
         node->assigments[i] = assigments[i];
@@ -148,81 +142,77 @@ ASTNode* create_let_in_node(VariableAssigmentNode** assigments, int assigment_co
 }
 
 
-ASTNode* create_variable_node(char *name, TypeTable *table) {
-    VariableNode *node = malloc(sizeof(VariableNode));
+ASTNode* create_variable_node(char *name, CompilationContext* ctx) {
+    VariableNode *node = arena_alloc(&ctx->arena, sizeof(VariableNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Variable, type_table_lookup(table, "Undefined"));
+    create_ast_base(&node->base, AST_Node_Variable, ctx->builtins->undefined, ctx);
 
-    node->name = strdup(name);
+    node->name = name;
     node->scope = NULL;
+    node->binding = NULL;
 
     return (ASTNode*) node;
 }
 
-ASTNode* create_reassign_node(char *name, ASTNode *value, TypeTable *table) {
-    ReassignNode *node = malloc(sizeof(ReassignNode));
+ASTNode* create_reassign_node(char *name, ASTNode *value, CompilationContext* ctx) {
+    ReassignNode *node = arena_alloc(&ctx->arena, sizeof(ReassignNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Reassign, type_table_lookup(table, "Undefined"));
-    node->name = strdup(name);
+    create_ast_base(&node->base, AST_Node_Reassign, ctx->builtins->undefined, ctx);
+    node->name = name;
     node->value = value;
     node->scope = NULL;
+    node->binding = NULL;
 
     return (ASTNode*) node;
 }
 
-ASTNode* create_function_definition_node(const char* name, char** param_names, char** param_types, int param_count, char* return_type, ASTNode* body, TypeTable* table) {
-    FunctionDefinitionNode* node = malloc(sizeof(FunctionDefinitionNode));
+ASTNode* create_function_definition_node(char* name, char** param_names, char** param_types, int param_count, char* return_type, ASTNode* body, CompilationContext* ctx) {
+    FunctionDefinitionNode* node = arena_alloc(&ctx->arena, sizeof(FunctionDefinitionNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Function_Definition, type_table_lookup(table, "Null"));
+    create_ast_base(&node->base, AST_Node_Function_Definition, ctx->builtins->null, ctx);
 
-    node->name = strdup(name);
+    node->name = name;
     node->param_count = param_count;
 
-    node->params = malloc(sizeof(Param*) * param_count);
+    node->params = arena_alloc(&ctx->arena, sizeof(Param*) * param_count);
     node->body = body;
     node->scope = NULL;
 
     node->static_return_type = return_type;
 
     for (int i = 0; i < param_count; i++) {
-        Param* param = malloc(sizeof(Param));
-        param->name = strdup(param_names[i]);
-        param->static_type = strdup(param_types[i]);
+        Param* param = arena_alloc(&ctx->arena, sizeof(Param));
+        param->name = param_names[i];
+        param->static_type = param_types[i];
         node->params[i] = param;
     }
 
     return (ASTNode*) node;
 }
 
-ASTNode* create_function_definition_list_node(TypeTable* table) {
-    FunctionDefinitionListNode* node = malloc(sizeof(FunctionDefinitionListNode));
-    create_ast_base(&node->base, AST_Node_Function_Definition_List, type_table_lookup(table, "Null"));
-    node->functions = NULL;
-    node->function_count = 0;
+ASTNode* create_function_definition_list_node(FunctionDefinitionNode** functions, int count, CompilationContext* ctx) {
+    FunctionDefinitionListNode* node = arena_alloc(&ctx->arena, sizeof(FunctionDefinitionListNode));
+    create_ast_base(&node->base, AST_Node_Function_Definition_List, ctx->builtins->null, ctx);
+    node->function_count = count;
+    node->functions = count > 0 ? arena_memdup(&ctx->arena, functions, sizeof(FunctionDefinitionNode*) * count) : NULL;
     return (ASTNode*) node;
 }
-    
-ASTNode* append_function_definition_to_list(FunctionDefinitionListNode* list, FunctionDefinitionNode* def) {
-    list->functions = realloc(list->functions, sizeof(FunctionDefinitionNode*) * (list->function_count + 1));
-    list->functions[list->function_count] = def;
-    list->function_count++;
-    return (ASTNode*)list;
-}
 
-ASTNode* create_function_call_node(char* name, ASTNode** args, int arg_count, TypeTable *table) {
-    FunctionCallNode *node = malloc(sizeof(FunctionCallNode));
+ASTNode* create_function_call_node(char* name, ASTNode** args, int arg_count, CompilationContext* ctx) {
+    FunctionCallNode *node = arena_alloc(&ctx->arena, sizeof(FunctionCallNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Function_Call, type_table_lookup(table, "Undefined"));
-    node->name = strdup(name);
+    create_ast_base(&node->base, AST_Node_Function_Call, ctx->builtins->undefined, ctx);
+    node->name = name;
     node->arg_count = arg_count;
     node->scope = NULL;
+    node->binding = NULL;
 
 
-    node->args = malloc(sizeof(ASTNode*) * arg_count);
+    node->args = arena_alloc(&ctx->arena, sizeof(ASTNode*) * arg_count);
     
     for (int i = 0; i < arg_count; i++) {
         node->args[i] = args[i];
@@ -230,14 +220,14 @@ ASTNode* create_function_call_node(char* name, ASTNode** args, int arg_count, Ty
     return (ASTNode*) node ;    
 }
 
-ASTNode* create_type_definition_node(char* type_name, char** param_names, char** param_types, int param_count, char* parent_name, ASTNode** parent_args, int parent_arg_count, ASTNode* body, TypeTable* table)
+ASTNode* create_type_definition_node(char* type_name, char** param_names, char** param_types, int param_count, char* parent_name, ASTNode** parent_args, int parent_arg_count, ASTNode* body, CompilationContext* ctx)
 {
-    TypeDefinitionNode* node = malloc(sizeof(TypeDefinitionNode));
+    TypeDefinitionNode* node = arena_alloc(&ctx->arena, sizeof(TypeDefinitionNode));
 
-    create_ast_base(&node->base, AST_Node_Type_Definition, type_table_lookup(table, "Null"));
+    create_ast_base(&node->base, AST_Node_Type_Definition, ctx->builtins->null, ctx);
 
-    node->type_name = strdup(type_name);
-    node->parent_name = strdup(parent_name);
+    node->type_name = type_name;
+    node->parent_name = parent_name;
 
     node->body = (ExpressionBlockNode*)body;
     node->scope = NULL;
@@ -249,12 +239,12 @@ ASTNode* create_type_definition_node(char* type_name, char** param_names, char**
     }
     else
     {
-        node->params = malloc(sizeof(Param*) * node->param_count);
+        node->params = arena_alloc(&ctx->arena, sizeof(Param*) * node->param_count);
         for (int i = 0; i < node->param_count; i++)
         {
-            Param* param = malloc(sizeof(Param));
-            param->name = strdup(param_names[i]);
-            param->static_type = strdup(param_types[i]);
+            Param* param = arena_alloc(&ctx->arena, sizeof(Param));
+            param->name = param_names[i];
+            param->static_type = param_types[i];
             node->params[i] = param;
         }
     }
@@ -267,7 +257,7 @@ ASTNode* create_type_definition_node(char* type_name, char** param_names, char**
     }
     else
     {
-        node->parent_args = malloc(sizeof(ASTNode*) * node->parent_arg_count);
+        node->parent_args = arena_alloc(&ctx->arena, sizeof(ASTNode*) * node->parent_arg_count);
         for (int i = 0; i < node->parent_arg_count; i++)
         {
             node->parent_args[i] = parent_args[i];
@@ -277,14 +267,14 @@ ASTNode* create_type_definition_node(char* type_name, char** param_names, char**
     return (ASTNode*)node;
 }
 
-ASTNode* create_type_definition_list_node(TypeDefinitionNode** list, int count, TypeTable* table) {
-    TypeDefinitionListNode* node = malloc(sizeof(TypeDefinitionListNode));
+ASTNode* create_type_definition_list_node(TypeDefinitionNode** list, int count, CompilationContext* ctx) {
+    TypeDefinitionListNode* node = arena_alloc(&ctx->arena, sizeof(TypeDefinitionListNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Type_Definition_List, type_table_lookup(table, "Null"));
+    create_ast_base(&node->base, AST_Node_Type_Definition_List, ctx->builtins->null, ctx);
 
     node->count = count;
-    node->definitions = malloc(sizeof(TypeDefinitionNode*) * count);
+    node->definitions = arena_alloc(&ctx->arena, sizeof(TypeDefinitionNode*) * count);
 
     for (int i = 0; i < count; i++) {
         node->definitions[i] = list[i];
@@ -293,14 +283,14 @@ ASTNode* create_type_definition_list_node(TypeDefinitionNode** list, int count,
     return (ASTNode*) node;
 }
 
-ASTNode* create_new_node(const char* type_name, ASTNode** args, int arg_count, TypeTable* table) {
-    NewNode* node = malloc(sizeof(NewNode));
-    create_ast_base(&node->base, AST_Node_New, type_table_lookup(table, "Undefined"));
-    node->type_name = strdup(type_name);
+ASTNode* create_new_node(char* type_name, ASTNode** args, int arg_count, CompilationContext* ctx) {
+    NewNode* node = arena_alloc(&ctx->arena, sizeof(NewNode));
+    create_ast_base(&node->base, AST_Node_New, ctx->builtins->undefined, ctx);
+    node->type_name = type_name;
     node->arg_count = arg_count;
     
     if (arg_count > 0) {
-        node->args = malloc(sizeof(ASTNode*) * arg_count);
+        node->args = arena_alloc(&ctx->arena, sizeof(ASTNode*) * arg_count);
         for (int i = 0; i < arg_count; i++) {
             node->args[i] = args[i];
         }
@@ -311,18 +301,18 @@ ASTNode* create_new_node(const char* type_name, ASTNode** args, int arg_count, T
     return (ASTNode*)node;
 }
 
-ASTNode* create_attribute_access_node(ASTNode* object, const char* attribute_name, ASTNode** args, int arg_count, bool is_method_call, TypeTable* table) {
-    AttributeAccessNode* node = malloc(sizeof(AttributeAccessNode));
-    create_ast_base(&node->base, AST_Node_Attribute_Access, type_table_lookup(table, "Undefined"));
+ASTNode* create_attribute_access_node(ASTNode* object, char* attribute_name, ASTNode** args, int arg_count, bool is_method_call, CompilationContext* ctx) {
+    AttributeAccessNode* node = arena_alloc(&ctx->arena, sizeof(AttributeAccessNode));
+    create_ast_base(&node->base, AST_Node_Attribute_Access, ctx->builtins->undefined, ctx);
 
     node->object = object;
-    node->attribute_name = strdup(attribute_name); // Copia del string
+    node->attribute_name = attribute_name;
     node->arg_count = arg_count;
     node->is_method_call = is_method_call;
 
     if(arg_count > 0)
     {
-        node->args = malloc(sizeof(ASTNode*) * arg_count); 
+        node->args = arena_alloc(&ctx->arena, sizeof(ASTNode*) * arg_count); 
         for (int i = 0; i < arg_count; i++) {
             node->args[i] = args[i]; // Copia de los nodos de argumentos
         }
@@ -333,26 +323,27 @@ ASTNode* create_attribute_access_node(ASTNode* object, const char* attribute_nam
     return (ASTNode*)node;
 }
 
-ASTNode* create_program_node(ASTNode* function_list, ASTNode* type_definitions, ASTNode *root, TypeTable *table) {
-    ProgramNode *node = malloc(sizeof(ProgramNode));
+ASTNode* create_program_node(ASTNode* function_list, ASTNode* type_definitions, ASTNode *root, CompilationContext* ctx) {
+    ProgramNode *node = arena_alloc(&ctx->arena, sizeof(ProgramNode));
     if (!node) return NULL;
 
-    create_ast_base(&node->base, AST_Node_Program, type_table_lookup(table, "Null"));
+    create_ast_base(&node->base, AST_Node_Program, ctx->builtins->null, ctx);
     node->function_list = (FunctionDefinitionListNode*) function_list;
     node->type_definitions = (TypeDefinitionListNode*) type_definitions;
     node->root = root;
+    node->slot_count = 0;
 
     return (ASTNode*) node;
 }
 
-VariableAssigment* create_variable_assigment(const char* name, const char* static_type, ASTNode* value) {
+VariableAssigment* create_variable_assigment(char* name, char* static_type, ASTNode* value, CompilationContext* ctx) {
     if (!name || !static_type || !value) return NULL;
 
-    VariableAssigment* assignment = malloc(sizeof(VariableAssigment));
+    VariableAssigment* assignment = arena_alloc(&ctx->arena, sizeof(VariableAssigment));
     if (!assignment) return NULL;
 
-    assignment->name = strdup(name);
-    assignment->static_type = strdup(static_type);
+    assignment->name = name;
+    assignment->static_type = static_type;
     assignment->value = value;
 
     return assignment;
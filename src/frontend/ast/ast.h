@@ -3,6 +3,7 @@
 
 #include "../common/common.h"
 #include "../scope/symbol_table.h"
+#include "../common/context.h"
 #include <llvm-c/Core.h>
 #include <llvm-c/Analysis.h>
 
@@ -10,6 +11,7 @@
 typedef struct TypeDescriptor TypeDescriptor;
 typedef struct TypeTable TypeTable;
 typedef struct SymbolTable SymbolTable;
+typedef struct Symbol Symbol;
 struct LLVMCodeGenerator;
 
 typedef enum {
@@ -33,13 +35,16 @@ typedef enum {
     AST_Node_Attribute_Access,
 } ASTNodeType;
 
+// Nodos sin posicion en la fuente (funciones predefinidas, nodos del codegen)
+#define AST_NO_LOC 0
+
 typedef struct ASTNode {
-    // Nodo base del AST (Abstract Syntax Tree)
+    // Nodo base del AST (Abstract Syntax Tree). Solo guarda los campos que leen
+    // todos los recorridos; la posicion en la fuente, que solo se usa en los
+    // diagnosticos, vive aparte en CompilationContext::node_locs[id].
     ASTNodeType type;            // Tipo de nodo AST
+    uint32_t id;                 // Indice del nodo en la compilacion (AST_NO_LOC si no tiene posicion)
     TypeDescriptor* return_type; // Tipo de retorno del nodo AST
-    LLVMValueRef (*accept)(struct ASTNode* self, struct LLVMCodeGenerator* visitor);
-    int line;
-    char* line_text;
 } ASTNode;
 
 typedef struct LiteralNode {
@@ -110,6 +115,7 @@ typedef struct VariableNode {
     ASTNode base;
     char* name;
     SymbolTable* scope; // Scope donde se encuentra la variable
+    Symbol* binding;    // Simbolo al que se refiere (resolve_bindings)
 } VariableNode;
 
 typedef struct ReassignNode {
@@ -117,6 +123,7 @@ typedef struct ReassignNode {
     char* name;
     ASTNode* value;
     SymbolTable* scope;
+    Symbol* binding;    // Variable reasignada (resolve_bindings)
 } ReassignNode;
 
 typedef struct Param {
@@ -147,6 +154,7 @@ typedef struct FunctionCallNode {
     ASTNode** args; 
     int arg_count;
     SymbolTable* scope;
+    Symbol* binding;    // Funcion llamada (resolve_bindings)
 } FunctionCallNode;
 
 typedef struct TypeDefinitionNode {
@@ -193,33 +201,35 @@ typedef struct ProgramNode {
     FunctionDefinitionListNode* function_list;  // Lista de definiciones de funciones
     TypeDefinitionListNode* type_definitions;   // Lista de definiciones de tipos
     ASTNode* root; // Bloque principal del programa
+    int slot_count; // Slots asignados por resolve_bindings
 } ProgramNode;
 
-// Prototipos para crear nodos AST
-void create_ast_base(ASTNode* base, ASTNodeType type, TypeDescriptor* return_type);
-ASTNode* create_number_literal_node(double value, TypeTable* table);
-ASTNode* create_string_literal_node(char* value, TypeTable* table);
-ASTNode* create_bool_literal_node(int value, TypeTable *table);
-ASTNode* create_unary_operation_node(HULK_Op operator, ASTNode* operand, TypeTable* table);
-ASTNode* create_binary_operation_node(HULK_Op operator, ASTNode* left, ASTNode* right, TypeTable* table);
-ASTNode* create_expression_block_node(ASTNode **expressions, int expression_count, TypeTable* table);
-ASTNode* create_conditional_node(ASTNode* condition, ASTNode* then_branch, ASTNode* else_branch, TypeTable* table);
-ASTNode* create_while_loop_node(ASTNode* condition, ASTNode* body, TypeTable* table); 
-ASTNode* create_let_in_node(VariableAssigmentNode** assigments, int assigment_count, ASTNode* body, TypeTable* table);
-ASTNode* create_variable_node(char* name, TypeTable* table);
-ASTNode* create_variable_assigment_node(VariableAssigment* assigment, TypeTable* table);
-ASTNode* create_reassign_node(char* name, ASTNode* value, TypeTable* table);
-ASTNode* create_function_definition_node(const char* name, char** param_names, char** param_types, int param_count, char* return_type, ASTNode* body, TypeTable* table);
-ASTNode* create_function_definition_list_node(TypeTable* table);
-ASTNode* create_function_call_node(char* name, ASTNode** args, int arg_count, TypeTable* table);
-ASTNode* create_type_definition_node(char* type_name, char** param_names, char** param_types, int param_count, char* parent_name, ASTNode** parent_args, int parent_arg_count, ASTNode* body, TypeTable* table);
-ASTNode* create_type_definition_list_node(TypeDefinitionNode** list, int count, TypeTable* table);
-ASTNode* create_new_node(const char* type_name, ASTNode** args, int arg_count, TypeTable* table);
-ASTNode* create_attribute_access_node(ASTNode* object, const char* attribute_name, ASTNode** args, int arg_count, bool is_method_call, TypeTable* table);
-ASTNode* create_program_node(ASTNode* function_list, ASTNode* type_list, ASTNode* root, TypeTable* table);
+// Prototipos para crear nodos AST. Todo se reserva en ctx->arena (nodos, arreglos
+// y Params) y se libera junto con free_compilation_context. Los strings no se
+// copian: deben vivir tanto como el AST (arena de la compilacion o literales).
+void create_ast_base(ASTNode* base, ASTNodeType type, TypeDescriptor* return_type, CompilationContext* ctx);
+ASTNode* create_number_literal_node(double value, CompilationContext* ctx);
+ASTNode* create_string_literal_node(char* value, CompilationContext* ctx);
+ASTNode* create_bool_literal_node(int value, CompilationContext* ctx);
+ASTNode* create_unary_operation_node(HULK_Op operator, ASTNode* operand, CompilationContext* ctx);
+ASTNode* create_binary_operation_node(HULK_Op operator, ASTNode* left, ASTNode* right, CompilationContext* ctx);
+ASTNode* create_expression_block_node(ASTNode **expressions, int expression_count, CompilationContext* ctx);
+ASTNode* create_conditional_node(ASTNode* condition, ASTNode* then_branch, ASTNode* else_branch, CompilationContext* ctx);
+ASTNode* create_while_loop_node(ASTNode* condition, ASTNode* body, CompilationContext* ctx); 
+ASTNode* create_let_in_node(VariableAssigmentNode** assigments, int assigment_count, ASTNode* body, CompilationContext* ctx);
+ASTNode* create_variable_node(char* name, CompilationContext* ctx);
+ASTNode* create_variable_assigment_node(VariableAssigment* assigment, CompilationContext* ctx);
+ASTNode* create_reassign_node(char* name, ASTNode* value, CompilationContext* ctx);
+ASTNode* create_function_definition_node(char* name, char** param_names, char** param_types, int param_count, char* return_type, ASTNode* body, CompilationContext* ctx);
+ASTNode* create_function_definition_list_node(FunctionDefinitionNode** functions, int count, CompilationContext* ctx);
+ASTNode* create_function_call_node(char* name, ASTNode** args, int arg_count, CompilationContext* ctx);
+ASTNode* create_type_definition_node(char* type_name, char** param_names, char** param_types, int param_count, char* parent_name, ASTNode** parent_args, int parent_arg_count, ASTNode* body, CompilationContext* ctx);
+ASTNode* create_type_definition_list_node(TypeDefinitionNode** list, int count, CompilationContext* ctx);
+ASTNode* create_new_node(char* type_name, ASTNode** args, int arg_count, CompilationContext* ctx);
+ASTNode* create_attribute_access_node(ASTNode* object, char* attribute_name, ASTNode** args, int arg_count, bool is_method_call, CompilationContext* ctx);
+ASTNode* create_program_node(ASTNode* function_list, ASTNode* type_list, ASTNode* root, CompilationContext* ctx);
 
-VariableAssigment* create_variable_assigment(const char* name, const char* static_type, ASTNode* value);
-ASTNode* append_function_definition_to_list(FunctionDefinitionListNode* list, FunctionDefinitionNode* def);
+VariableAssigment* create_variable_assigment(char* name, char* static_type, ASTNode* value, CompilationContext* ctx);
 
 // Prototipos para imprimir nodos(Debug)
 void print_ast_node(ASTNode* node, int indent_level);
@@ -243,25 +253,4 @@ void print_attribute_access_node(AttributeAccessNode* node, int indent);
 void print_program_node(ProgramNode* node, int indent_level);
 void print_indent(int indent);
 
-// Prototipos para liberar nodos AST
-void free_ast_node(ASTNode* node);
-void free_literal_node(LiteralNode* node);
-void free_unary_operation_node(UnaryOperationNode* node);
-void free_binary_operation_node(BinaryOperationNode* node);
-void free_expression_block_node(ExpressionBlockNode* node);
-void free_conditional_node(ConditionalNode* node);
-void free_while_loop_node(WhileLoopNode* node);
-void free_let_in_node(LetInNode* node);
-void free_variable_node(VariableNode* node);
-void free_variable_assigment_node(VariableAssigmentNode* node);
-void free_reassign_node(ReassignNode* node);
-void free_function_definition_node(FunctionDefinitionNode* node);
-void free_function_definition_list_node(FunctionDefinitionListNode* node);
-void free_function_call_node(FunctionCallNode* node);
-void free_type_definition_node(TypeDefinitionNode* node);
-void free_type_definition_list_node(TypeDefinitionListNode* node);
-void free_new_node(NewNode* node);
-void free_attribute_access_node(AttributeAccessNode* node);
-void free_program_node(ProgramNode* node);
-
 #endif // AST_H
\ No newline at end of file
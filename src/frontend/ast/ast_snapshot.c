@@ -0,0 +1,967 @@
+#include "ast_snapshot.h"
+#include "../common/common.h"
+#include "../common/source.h"
+#include <errno.h>
+#include <stdint.h>
+
+// Layout del archivo (ver ast_snapshot.h):
+//   SnapshotHeader
+//   tipos de nodo       node_count x (u32 id, u32 kind)
+//   tipos del programa  type_count x (string nombre, u32 tag)
+//   cuerpos de nodos    node_count x (u32 id, return_type, campos segun kind)
+//   detalle de tipos    type_count x (parent, u8 inicializado, u8 info [, type_def, scope])
+//   scopes              scope_count x (parent, u32 n, n simbolos)
+//   scope global        u32 n, n simbolos agregados por el programa
+//
+// Referencias (u32): nodo = su id; tipo = indice en la TypeTable + 1;
+// scope = 1 para el global y indice + 2 para los del snapshot. 0 es NULL.
+// Strings: u32 longitud + bytes (NO_STRING para NULL).
+
+#define SNAPSHOT_MAGIC "HAST"
+#define SNAPSHOT_ENDIAN_MARK 0x01020304u
+#define NO_STRING UINT32_MAX
+#define GLOBAL_SCOPE_REF 1
+
+typedef struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t endian_mark;
+    uint32_t base_type_count;
+    uint32_t base_symbol_count;
+    uint32_t node_id_limit;     // Los ids validos van de 1 a node_id_limit
+    uint32_t node_count;        // Nodos guardados (los alcanzables desde el programa)
+    uint32_t type_count;        // Tipos agregados por el programa
+    uint32_t scope_count;
+    uint32_t program;           // Id del ProgramNode
+} SnapshotHeader;
+
+enum { LITERAL_NUMBER, LITERAL_STRING, LITERAL_BOOL };
+
+// ---------------------------------------------------------------------------
+// Escritura
+// ---------------------------------------------------------------------------
+
+// Tabla puntero -> indice (direccionamiento abierto, capacidad potencia de 2)
+typedef struct PtrMap {
+    const void** keys;
+    uint32_t* values;
+    size_t capacity;
+    size_t count;
+} PtrMap;
+
+static size_t ptr_hash(const void* ptr, size_t capacity) {
+    uintptr_t h = (uintptr_t)ptr;
+    h ^= h >> 17;
+    h *= (uintptr_t)0x9E3779B97F4A7C15ull;
+    return (size_t)(h >> 7) & (capacity - 1);
+}
+
+static void ptr_map_put(PtrMap* map, const void* key, uint32_t value);
+
+static void ptr_map_grow(PtrMap* map) {
+    PtrMap old = *map;
+    map->capacity = old.capacity ? old.capacity * 2 : 64;
+    map->keys = calloc(map->capacity, sizeof(const void*));
+    map->values = malloc(map->capacity * sizeof(uint32_t));
+    map->count = 0;
+    if (!map->keys || !map->values) DIE("Out of memory in ast snapshot");
+    for (size_t i = 0; i < old.capacity; i++)
+        if (old.keys[i]) ptr_map_put(map, old.keys[i], old.values[i]);
+    free(old.keys);
+    free(old.values);
+}
+
+static void ptr_map_put(PtrMap* map, const void* key, uint32_t value) {
+    if ((map->count + 1) * 2 > map->capacity)
+        ptr_map_grow(map);
+    size_t i = ptr_hash(key, map->capacity);
+    while (map->keys[i] && map->keys[i] != key)
+        i = (i + 1) & (map->capacity - 1);
+    if (!map->keys[i]) map->count++;
+    map->keys[i] = key;
+    map->values[i] = value;
+}
+
+static uint32_t ptr_map_get(const PtrMap* map, const void* key) {
+    if (!map->capacity) return 0;
+    size_t i = ptr_hash(key, map->capacity);
+    while (map->keys[i]) {
+        if (map->keys[i] == key) return map->values[i];
+        i = (i + 1) & (map->capacity - 1);
+    }
+    return 0;
+}
+
+static void ptr_map_free(PtrMap* map) {
+    free(map->keys);
+    free(map->values);
+}
+
+typedef struct SnapshotWriter {
+    unsigned char* data;
+    size_t size;
+    size_t capacity;
+    bool failed;
+
+    TypeTable* type_table;
+    PtrMap type_refs;           // TypeDescriptor* -> ref
+    SymbolTable* global_scope;
+    PtrMap scope_refs;          // SymbolTable* -> ref
+    SymbolTable** scopes;
+    uint32_t scope_count;
+    uint32_t scope_capacity;
+    ASTNode** nodes;            // Indexado por id
+    uint32_t node_id_limit;
+    uint32_t node_count;
+} SnapshotWriter;
+
+static void write_bytes(SnapshotWriter* w, const void* bytes, size_t size) {
+    if (w->size + size > w->capacity) {
+        size_t capacity = w->capacity ? w->capacity * 2 : 64 * 1024;
+        while (capacity < w->size + size) capacity *= 2;
+        w->data = realloc(w->data, capacity);
+        if (!w->data) DIE("Out of memory in ast snapshot");
+        w->capacity = capacity;
+    }
+    memcpy(w->data + w->size, bytes, size);
+    w->size += size;
+}
+
+static void write_u32(SnapshotWriter* w, uint32_t value) { write_bytes(w, &value, sizeof(value)); }
+static void write_u8(SnapshotWriter* w, uint8_t value) { write_bytes(w, &value, sizeof(value)); }
+
+static void write_string(SnapshotWriter* w, const char* str) {
+    if (!str) {
+        write_u32(w, NO_STRING);
+        return;
+    }
+    uint32_t length = (uint32_t)strlen(str);
+    write_u32(w, length);
+    write_bytes(w, str, length);
+}
+
+static void write_node_ref(SnapshotWriter* w, ASTNode* node) {
+    write_u32(w, node ? node->id : 0);
+}
+
+static void write_type_ref(SnapshotWriter* w, TypeDescriptor* type) {
+    uint32_t ref = type ? ptr_map_get(&w->type_refs, type) : 0;
+    if (type && !ref) {
+        fprintf(stderr, "Error: el tipo '%s' no esta en la tabla de tipos\n", type->type_name);
+        w->failed = true;
+    }
+    write_u32(w, ref);
+}
+
+static void write_scope_ref(SnapshotWriter* w, SymbolTable* scope) {
+    if (!scope) write_u32(w, 0);
+    else if (scope == w->global_scope) write_u32(w, GLOBAL_SCOPE_REF);
+    else write_u32(w, ptr_map_get(&w->scope_refs, scope));
+}
+
+static void collect_node(SnapshotWriter* w, ASTNode* node);
+
+static void collect_scope(SnapshotWriter* w, SymbolTable* scope) {
+    while (scope && scope != w->global_scope && !ptr_map_get(&w->scope_refs, scope)) {
+        if (w->scope_count == w->scope_capacity) {
+            w->scope_capacity = w->scope_capacity ? w->scope_capacity * 2 : 64;
+            w->scopes = realloc(w->scopes, w->scope_capacity * sizeof(SymbolTable*));
+            if (!w->scopes) DIE("Out of memory in ast snapshot");
+        }
+        w->scopes[w->scope_count++] = scope;
+        ptr_map_put(&w->scope_refs, scope, w->scope_count + 1);
+        scope = scope->parent;
+    }
+}
+
+static void collect_nodes(SnapshotWriter* w, ASTNode** nodes, int count) {
+    for (int i = 0; i < count; i++)
+        collect_node(w, nodes[i]);
+}
+
+static void collect_node(SnapshotWriter* w, ASTNode* node) {
+    if (!node) return;
+    if (node->id == AST_NO_LOC || node->id > w->node_id_limit) {
+        fprintf(stderr, "Error: nodo del AST sin id (tipo %d) en el snapshot\n", node->type);
+        w->failed = true;
+        return;
+    }
+    if (w->nodes[node->id]) return;
+    w->nodes[node->id] = node;
+    w->node_count++;
+
+    switch (node->type) {
+        case AST_Node_Literal:
+            break;
+        case AST_Node_Variable:
+            collect_scope(w, ((VariableNode*)node)->scope);
+            break;
+        case AST_Node_Unary_Operation:
+            collect_node(w, ((UnaryOperationNode*)node)->operand);
+            break;
+        case AST_Node_Binary_Operation:
+            collect_node(w, ((BinaryOperationNode*)node)->left);
+            collect_node(w, ((BinaryOperationNode*)node)->right);
+            break;
+        case AST_Node_Expression_Block: {
+            ExpressionBlockNode* block = (ExpressionBlockNode*)node;
+            collect_nodes(w, block->expressions, block->expression_count);
+            break;
+        }
+        case AST_Node_Conditional: {
+            ConditionalNode* cond = (ConditionalNode*)node;
+            collect_node(w, cond->condition);
+            collect_node(w, cond->then_branch);
+            collect_node(w, cond->else_branch);
+            break;
+        }
+        case AST_Node_While_Loop:
+            collect_node(w, ((WhileLoopNode*)node)->condition);
+            collect_node(w, ((WhileLoopNode*)node)->body);
+            break;
+        case AST_Node_Let_In: {
+            LetInNode* let = (LetInNode*)node;
+            collect_scope(w, let->scope);
+            collect_nodes(w, (ASTNode**)let->assigments, let->assigment_count);
+            collect_node(w, let->body);
+            break;
+        }
+        case AST_Node_Variable_Assigment: {
+            VariableAssigmentNode* assign = (VariableAssigmentNode*)node;
+            collect_scope(w, assign->scope);
+            collect_node(w, assign->assigment->value);
+            break;
+        }
+        case AST_Node_Reassign:
+            collect_scope(w, ((ReassignNode*)node)->scope);
+            collect_node(w, ((ReassignNode*)node)->value);
+            break;
+        case AST_Node_Function_Definition:
+            collect_scope(w, ((FunctionDefinitionNode*)node)->scope);
+            collect_node(w, ((FunctionDefinitionNode*)node)->body);
+            break;
+        case AST_Node_Function_Definition_List: {
+            FunctionDefinitionListNode* list = (FunctionDefinitionListNode*)node;
+            collect_nodes(w, (ASTNode**)list->functions, list->function_count);
+            break;
+        }
+        case AST_Node_Function_Call: {
+            FunctionCallNode* call = (FunctionCallNode*)node;
+            collect_scope(w, call->scope);
+            collect_nodes(w, call->args, call->arg_count);
+            break;
+        }
+        case AST_Node_Program: {
+            ProgramNode* program = (ProgramNode*)node;
+            collect_node(w, (ASTNode*)program->function_list);
+            collect_node(w, (ASTNode*)program->type_definitions);
+            collect_node(w, program->root);
+            break;
+        }
+        case AST_Node_Type_Definition: {
+            TypeDefinitionNode* type_def = (TypeDefinitionNode*)node;
+            collect_scope(w, type_def->scope);
+            collect_nodes(w, type_def->parent_args, type_def->parent_arg_count);
+            collect_node(w, (ASTNode*)type_def->body);
+            break;
+        }
+        case AST_Node_Type_Definition_List: {
+            TypeDefinitionListNode* list = (TypeDefinitionListNode*)node;
+            collect_nodes(w, (ASTNode**)list->definitions, list->count);
+            break;
+        }
+        case AST_Node_New:
+            collect_nodes(w, ((NewNode*)node)->args, ((NewNode*)node)->arg_count);
+            break;
+        case AST_Node_Attribute_Access: {
+            AttributeAccessNode* access = (AttributeAccessNode*)node;
+            collect_node(w, access->object);
+            collect_nodes(w, access->args, access->arg_count);
+            break;
+        }
+    }
+}
+
+static void write_node_refs(SnapshotWriter* w, ASTNode** nodes, int count) {
+    write_u32(w, (uint32_t)count);
+    for (int i = 0; i < count; i++)
+        write_node_ref(w, nodes[i]);
+}
+
+static void write_params(SnapshotWriter* w, Param** params, int count) {
+    write_u32(w, (uint32_t)count);
+    for (int i = 0; i < count; i++) {
+        write_string(w, params[i]->name);
+        write_string(w, params[i]->static_type);
+    }
+}
+
+static void write_node_body(SnapshotWriter* w, ASTNode* node) {
+    write_u32(w, node->id);
+    write_type_ref(w, node->return_type);
+
+    switch (node->type) {
+        case AST_Node_Literal: {
+            LiteralNode* literal = (LiteralNode*)node;
+            HULK_Type tag = node->return_type ? node->return_type->tag : HULK_Type_Number;
+            if (tag == HULK_Type_String) {
+                write_u8(w, LITERAL_STRING);
+                write_string(w, literal->value.string_value);
+            } else if (tag == HULK_Type_Boolean) {
+                write_u8(w, LITERAL_BOOL);
+                write_u32(w, (uint32_t)literal->value.bool_value);
+            } else {
+                write_u8(w, LITERAL_NUMBER);
+                write_bytes(w, &literal->value.number_value, sizeof(double));
+            }
+            break;
+        }
+        case AST_Node_Unary_Operation:
+            write_u32(w, ((UnaryOperationNode*)node)->operator);
+            write_node_ref(w, ((UnaryOperationNode*)node)->operand);
+            break;
+        case AST_Node_Binary_Operation:
+            write_u32(w, ((BinaryOperationNode*)node)->operator);
+            write_node_ref(w, ((BinaryOperationNode*)node)->left);
+            write_node_ref(w, ((BinaryOperationNode*)node)->right);
+            break;
+        case AST_Node_Expression_Block:
+            write_node_refs(w, ((ExpressionBlockNode*)node)->expressions, ((ExpressionBlockNode*)node)->expression_count);
+            break;
+        case AST_Node_Conditional:
+            write_node_ref(w, ((ConditionalNode*)node)->condition);
+            write_node_ref(w, ((ConditionalNode*)node)->then_branch);
+            write_node_ref(w, ((ConditionalNode*)node)->else_branch);
+            break;
+        case AST_Node_While_Loop:
+            write_node_ref(w, ((WhileLoopNode*)node)->condition);
+            write_node_ref(w, ((WhileLoopNode*)node)->body);
+            break;
+        case AST_Node_Let_In: {
+            LetInNode* let = (LetInNode*)node;
+            write_scope_ref(w, let->scope);
+            write_node_refs(w, (ASTNode**)let->assigments, let->assigment_count);
+            write_node_ref(w, let->body);
+            break;
+        }
+        case AST_Node_Variable_Assigment: {
+            VariableAssigmentNode* assign = (VariableAssigmentNode*)node;
+            write_scope_ref(w, assign->scope);
+            write_string(w, assign->assigment->name);
+            write_string(w, assign->assigment->static_type);
+            write_node_ref(w, assign->assigment->value);
+            break;
+        }
+        case AST_Node_Variable:
+            write_string(w, ((VariableNode*)node)->name);
+            write_scope_ref(w, ((VariableNode*)node)->scope);
+            break;
+        case AST_Node_Reassign:
+            write_string(w, ((ReassignNode*)node)->name);
+            write_node_ref(w, ((ReassignNode*)node)->value);
+            write_scope_ref(w, ((ReassignNode*)node)->scope);
+            break;
+        case AST_Node_Function_Definition: {
+            FunctionDefinitionNode* function = (FunctionDefinitionNode*)node;
+            write_string(w, function->name);
+            write_scope_ref(w, function->scope);
+            write_params(w, function->params, function->param_count);
+            write_string(w, function->static_return_type);
+            write_node_ref(w, function->body);
+            break;
+        }
+        case AST_Node_Function_Definition_List: {
+            FunctionDefinitionListNode* list = (FunctionDefinitionListNode*)node;
+            write_node_refs(w, (ASTNode**)list->functions, list->function_count);
+            break;
+        }
+        case AST_Node_Function_Call: {
+            FunctionCallNode* call = (FunctionCallNode*)node;
+            write_string(w, call->name);
+            write_node_refs(w, call->args, call->arg_count);
+            write_scope_ref(w, call->scope);
+            break;
+        }
+        case AST_Node_Program: {
+            ProgramNode* program = (ProgramNode*)node;
+            write_node_ref(w, (ASTNode*)program->function_list);
+            write_node_ref(w, (ASTNode*)program->type_definitions);
+            write_node_ref(w, program->root);
+            break;
+        }
+        case AST_Node_Type_Definition: {
+            TypeDefinitionNode* type_def = (TypeDefinitionNode*)node;
+            write_string(w, type_def->type_name);
+            write_params(w, type_def->params, type_def->param_count);
+            write_string(w, type_def->parent_name);
+            write_node_refs(w, type_def->parent_args, type_def->parent_arg_count);
+            write_scope_ref(w, type_def->scope);
+            write_node_ref(w, (ASTNode*)type_def->body);
+            break;
+        }
+        case AST_Node_Type_Definition_List: {
+            TypeDefinitionListNode* list = (TypeDefinitionListNode*)node;
+            write_node_refs(w, (ASTNode**)list->definitions, list->count);
+            break;
+        }
+        case AST_Node_New:
+            write_string(w, ((NewNode*)node)->type_name);
+            write_node_refs(w, ((NewNode*)node)->args, ((NewNode*)node)->arg_count);
+            break;
+        case AST_Node_Attribute_Access: {
+            AttributeAccessNode* access = (AttributeAccessNode*)node;
+            write_node_ref(w, access->object);
+            write_string(w, access->attribute_name);
+            write_node_refs(w, access->args, access->arg_count);
+            write_u8(w, access->is_method_call);
+            break;
+        }
+    }
+}
+
+static void write_symbols(SnapshotWriter* w, SymbolTable* scope, int first) {
+    write_u32(w, (uint32_t)(scope->size - first));
+    for (int i = first; i < scope->size; i++) {
+        Symbol* symbol = scope->symbols[i];
+        if (symbol->value && symbol->value->id == AST_NO_LOC) {
+            fprintf(stderr, "Error: el simbolo '%s' apunta a un nodo que no es del programa\n", symbol->name);
+            w->failed = true;
+        }
+        write_string(w, symbol->name);
+        write_u32(w, symbol->kind);
+        write_type_ref(w, symbol->type);
+        write_node_ref(w, symbol->value);
+    }
+}
+
+bool ast_snapshot_write(const char* path, ProgramNode* program, const CompilationContext* ctx,
+                        SymbolTable* global_scope, int base_type_count, int base_symbol_count) {
+    SnapshotWriter w = { 0 };
+    w.type_table = ctx->type_table;
+    w.global_scope = global_scope;
+    w.node_id_limit = (uint32_t)ctx->ast_node_count;
+    w.nodes = calloc(w.node_id_limit + 1, sizeof(ASTNode*));
+    if (!w.nodes) DIE("Out of memory in ast snapshot");
+
+    for (int i = 0; i < w.type_table->count; i++)
+        ptr_map_put(&w.type_refs, w.type_table->types[i], (uint32_t)i + 1);
+
+    // Nodos alcanzables desde el programa y todos los scopes que cuelgan de ellos
+    collect_node(&w, (ASTNode*)program);
+    for (int i = base_type_count; i < w.type_table->count; i++) {
+        TypeInfo* info = w.type_table->types[i]->info;
+        if (info) {
+            collect_scope(&w, info->scope);
+            collect_node(&w, (ASTNode*)info->type_def);
+        }
+    }
+
+    // Los valores de los simbolos pueden colgar nodos y scopes nuevos
+    for (int j = base_symbol_count; j < global_scope->size; j++)
+        collect_node(&w, global_scope->symbols[j]->value);
+    for (uint32_t i = 0; i < w.scope_count; i++)
+        for (int j = 0; j < w.scopes[i]->size; j++)
+            collect_node(&w, w.scopes[i]->symbols[j]->value);
+
+    SnapshotHeader header = { 0 };
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = AST_SNAPSHOT_VERSION;
+    header.endian_mark = SNAPSHOT_ENDIAN_MARK;
+    header.base_type_count = (uint32_t)base_type_count;
+    header.base_symbol_count = (uint32_t)base_symbol_count;
+    header.node_id_limit = w.node_id_limit;
+    header.node_count = w.node_count;
+    header.type_count = (uint32_t)(w.type_table->count - base_type_count);
+    header.scope_count = w.scope_count;
+    header.program = program->base.id;
+    write_bytes(&w, &header, sizeof(header));
+
+    for (uint32_t id = 1; id <= w.node_id_limit; id++) {
+        if (!w.nodes[id]) continue;
+        write_u32(&w, id);
+        write_u32(&w, w.nodes[id]->type);
+    }
+
+    for (int i = base_type_count; i < w.type_table->count; i++) {
+        write_string(&w, w.type_table->types[i]->type_name);
+        write_u32(&w, w.type_table->types[i]->tag);
+    }
+
+    for (uint32_t id = 1; id <= w.node_id_limit; id++)
+        if (w.nodes[id]) write_node_body(&w, w.nodes[id]);
+
+    for (int i = base_type_count; i < w.type_table->count; i++) {
+        TypeDescriptor* type = w.type_table->types[i];
+        write_type_ref(&w, type->parent);
+        write_u8(&w, type->initializated);
+        write_u8(&w, type->info != NULL);
+        if (type->info) {
+            write_node_ref(&w, (ASTNode*)type->info->type_def);
+            write_scope_ref(&w, type->info->scope);
+        }
+    }
+
+    for (uint32_t i = 0; i < w.scope_count; i++) {
+        SymbolTable* scope = w.scopes[i];
+        write_scope_ref(&w, scope->parent);
+        write_symbols(&w, scope, 0);
+    }
+    write_symbols(&w, global_scope, base_symbol_count);
+
+    bool ok = !w.failed;
+    if (ok) {
+        FILE* file = fopen(path, "wb");
+        if (!file) {
+            fprintf(stderr, "No se pudo escribir '%s': %s\n", path, strerror(errno));
+            ok = false;
+        } else {
+            ok = fwrite(w.data, 1, w.size, file) == w.size;
+            if (fclose(file) != 0) ok = false;
+            if (!ok) {
+                fprintf(stderr, "No se pudo escribir '%s'\n", path);
+                remove(path);
+            }
+        }
+    }
+
+    free(w.data);
+    free(w.nodes);
+    free(w.scopes);
+    ptr_map_free(&w.type_refs);
+    ptr_map_free(&w.scope_refs);
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+// Lectura
+// ---------------------------------------------------------------------------
+
+typedef struct SnapshotReader {
+    const unsigned char* data;
+    size_t size;
+    size_t pos;
+    bool failed;
+
+    CompilationContext* ctx;
+    TypeTable* type_table;
+    SymbolTable* global_scope;
+    SymbolTable** scopes;
+    uint32_t scope_count;
+    ASTNode** nodes;            // Indexado por id
+    uint32_t node_id_limit;
+} SnapshotReader;
+
+static const void* read_bytes(SnapshotReader* r, size_t size) {
+    if (r->failed || size > r->size - r->pos) {
+        r->failed = true;
+        return NULL;
+    }
+    const void* bytes = r->data + r->pos;
+    r->pos += size;
+    return bytes;
+}
+
+static uint32_t read_u32(SnapshotReader* r) {
+    uint32_t value = 0;
+    const void* bytes = read_bytes(r, sizeof(value));
+    if (bytes) memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+static uint8_t read_u8(SnapshotReader* r) {
+    const uint8_t* bytes = read_bytes(r, 1);
+    return bytes ? *bytes : 0;
+}
+
+static char* read_string(SnapshotReader* r) {
+    uint32_t length = read_u32(r);
+    if (length == NO_STRING) return NULL;
+    const char* bytes = read_bytes(r, length);
+    return bytes ? intern_string_n(bytes, length) : NULL;
+}
+
+static ASTNode* read_node_ref(SnapshotReader* r) {
+    uint32_t id = read_u32(r);
+    if (id == 0) return NULL;
+    if (id > r->node_id_limit || !r->nodes[id]) {
+        r->failed = true;
+        return NULL;
+    }
+    return r->nodes[id];
+}
+
+// Lee una referencia a un nodo que tiene que ser de 'kind'
+static ASTNode* read_node_ref_of(SnapshotReader* r, ASTNodeType kind) {
+    ASTNode* node = read_node_ref(r);
+    if (node && node->type != kind) {
+        r->failed = true;
+        return NULL;
+    }
+    return node;
+}
+
+static TypeDescriptor* read_type_ref(SnapshotReader* r) {
+    uint32_t ref = read_u32(r);
+    if (ref == 0) return NULL;
+    if (ref > (uint32_t)r->type_table->count) {
+        r->failed = true;
+        return NULL;
+    }
+    return r->type_table->types[ref - 1];
+}
+
+static SymbolTable* read_scope_ref(SnapshotReader* r) {
+    uint32_t ref = read_u32(r);
+    if (ref == 0) return NULL;
+    if (ref == GLOBAL_SCOPE_REF) return r->global_scope;
+    if (ref - 2 >= r->scope_count) {
+        r->failed = true;
+        return NULL;
+    }
+    return r->scopes[ref - 2];
+}
+
+// Cantidad de elementos de una lista; acotada por lo que queda del archivo
+static int read_count(SnapshotReader* r) {
+    uint32_t count = read_u32(r);
+    if (count > (r->size - r->pos) / sizeof(uint32_t) + 1) {
+        r->failed = true;
+        return 0;
+    }
+    return (int)count;
+}
+
+static ASTNode** read_node_refs(SnapshotReader* r, int* count) {
+    *count = read_count(r);
+    if (*count == 0) return NULL;
+    ASTNode** nodes = arena_alloc(&r->ctx->arena, sizeof(ASTNode*) * (size_t)*count);
+    for (int i = 0; i < *count; i++)
+        nodes[i] = read_node_ref(r);
+    return nodes;
+}
+
+static Param** read_params(SnapshotReader* r, int* count) {
+    *count = read_count(r);
+    if (*count == 0) return NULL;
+    Param** params = arena_alloc(&r->ctx->arena, sizeof(Param*) * (size_t)*count);
+    for (int i = 0; i < *count; i++) {
+        params[i] = arena_alloc(&r->ctx->arena, sizeof(Param));
+        params[i]->name = read_string(r);
+        params[i]->static_type = read_string(r);
+    }
+    return params;
+}
+
+static size_t node_size(ASTNodeType kind) {
+    switch (kind) {
+        case AST_Node_Literal:                  return sizeof(LiteralNode);
+        case AST_Node_Unary_Operation:          return sizeof(UnaryOperationNode);
+        case AST_Node_Binary_Operation:         return sizeof(BinaryOperationNode);
+        case AST_Node_Expression_Block:         return sizeof(ExpressionBlockNode);
+        case AST_Node_Conditional:              return sizeof(ConditionalNode);
+        case AST_Node_While_Loop:               return sizeof(WhileLoopNode);
+        case AST_Node_Let_In:                   return sizeof(LetInNode);
+        case AST_Node_Variable:                 return sizeof(VariableNode);
+        case AST_Node_Variable_Assigment:       return sizeof(VariableAssigmentNode);
+        case AST_Node_Reassign:                 return sizeof(ReassignNode);
+        case AST_Node_Function_Definition:      return sizeof(FunctionDefinitionNode);
+        case AST_Node_Function_Definition_List: return sizeof(FunctionDefinitionListNode);
+        case AST_Node_Function_Call:            return sizeof(FunctionCallNode);
+        case AST_Node_Program:                  return sizeof(ProgramNode);
+        case AST_Node_Type_Definition:          return sizeof(TypeDefinitionNode);
+        case AST_Node_Type_Definition_List:     return sizeof(TypeDefinitionListNode);
+        case AST_Node_New:                      return sizeof(NewNode);
+        case AST_Node_Attribute_Access:         return sizeof(AttributeAccessNode);
+    }
+    return 0;
+}
+
+static void read_node_body(SnapshotReader* r) {
+    ASTNode* node = read_node_ref(r);
+    if (!node) {
+        r->failed = true;
+        return;
+    }
+    node->return_type = read_type_ref(r);
+
+    switch (node->type) {
+        case AST_Node_Literal: {
+            LiteralNode* literal = (LiteralNode*)node;
+            uint8_t kind = read_u8(r);
+            if (kind == LITERAL_STRING)
+                literal->value.string_value = read_string(r);
+            else if (kind == LITERAL_BOOL)
+                literal->value.bool_value = (int)read_u32(r);
+            else {
+                const void* bytes = read_bytes(r, sizeof(double));
+                if (bytes) memcpy(&literal->value.number_value, bytes, sizeof(double));
+            }
+            break;
+        }
+        case AST_Node_Unary_Operation: {
+            UnaryOperationNode* unary = (UnaryOperationNode*)node;
+            unary->operator = (HULK_Op)read_u32(r);
+            unary->operand = read_node_ref(r);
+            break;
+        }
+        case AST_Node_Binary_Operation: {
+            BinaryOperationNode* binary = (BinaryOperationNode*)node;
+            binary->operator = (HULK_Op)read_u32(r);
+            binary->left = read_node_ref(r);
+            binary->right = read_node_ref(r);
+            break;
+        }
+        case AST_Node_Expression_Block: {
+            ExpressionBlockNode* block = (ExpressionBlockNode*)node;
+            block->expressions = read_node_refs(r, &block->expression_count);
+            break;
+        }
+        case AST_Node_Conditional: {
+            ConditionalNode* cond = (ConditionalNode*)node;
+            cond->condition = read_node_ref(r);
+            cond->then_branch = read_node_ref(r);
+            cond->else_branch = read_node_ref(r);
+            break;
+        }
+        case AST_Node_While_Loop: {
+            WhileLoopNode* loop = (WhileLoopNode*)node;
+            loop->condition = read_node_ref(r);
+            loop->body = read_node_ref(r);
+            break;
+        }
+        case AST_Node_Let_In: {
+            LetInNode* let = (LetInNode*)node;
+            let->scope = read_scope_ref(r);
+            let->assigments = (VariableAssigmentNode**)read_node_refs(r, &let->assigment_count);
+            for (int i = 0; i < let->assigment_count; i++)
+                if (let->assigments[i] && let->assigments[i]->base.type != AST_Node_Variable_Assigment)
+                    r->failed = true;
+            let->body = read_node_ref(r);
+            break;
+        }
+        case AST_Node_Variable_Assigment: {
+            VariableAssigmentNode* assign = (VariableAssigmentNode*)node;
+            assign->scope = read_scope_ref(r);
+            assign->assigment = arena_alloc(&r->ctx->arena, sizeof(VariableAssigment));
+            assign->assigment->name = read_string(r);
+            assign->assigment->static_type = read_string(r);
+            assign->assigment->value = read_node_ref(r);
+            break;
+        }
+        case AST_Node_Variable: {
+            VariableNode* variable = (VariableNode*)node;
+            variable->name = read_string(r);
+            variable->scope = read_scope_ref(r);
+            break;
+        }
+        case AST_Node_Reassign: {
+            ReassignNode* reassign = (ReassignNode*)node;
+            reassign->name = read_string(r);
+            reassign->value = read_node_ref(r);
+            reassign->scope = read_scope_ref(r);
+            break;
+        }
+        case AST_Node_Function_Definition: {
+            FunctionDefinitionNode* function = (FunctionDefinitionNode*)node;
+            function->name = read_string(r);
+            function->scope = read_scope_ref(r);
+            function->params = read_params(r, &function->param_count);
+            function->static_return_type = read_string(r);
+            function->body = read_node_ref(r);
+            break;
+        }
+        case AST_Node_Function_Definition_List: {
+            FunctionDefinitionListNode* list = (FunctionDefinitionListNode*)node;
+            list->functions = (FunctionDefinitionNode**)read_node_refs(r, &list->function_count);
+            for (int i = 0; i < list->function_count; i++)
+                if (list->functions[i] && list->functions[i]->base.type != AST_Node_Function_Definition)
+                    r->failed = true;
+            break;
+        }
+        case AST_Node_Function_Call: {
+            FunctionCallNode* call = (FunctionCallNode*)node;
+            call->name = read_string(r);
+            call->args = read_node_refs(r, &call->arg_count);
+            call->scope = read_scope_ref(r);
+            break;
+        }
+        case AST_Node_Program: {
+            ProgramNode* program = (ProgramNode*)node;
+            program->function_list = (FunctionDefinitionListNode*)read_node_ref_of(r, AST_Node_Function_Definition_List);
+            program->type_definitions = (TypeDefinitionListNode*)read_node_ref_of(r, AST_Node_Type_Definition_List);
+            program->root = read_node_ref(r);
+            break;
+        }
+        case AST_Node_Type_Definition: {
+            TypeDefinitionNode* type_def = (TypeDefinitionNode*)node;
+            type_def->type_name = read_string(r);
+            type_def->params = read_params(r, &type_def->param_count);
+            type_def->parent_name = read_string(r);
+            type_def->parent_args = read_node_refs(r, &type_def->parent_arg_count);
+            type_def->scope = read_scope_ref(r);
+            type_def->body = (ExpressionBlockNode*)read_node_ref_of(r, AST_Node_Expression_Block);
+            break;
+        }
+        case AST_Node_Type_Definition_List: {
+            TypeDefinitionListNode* list = (TypeDefinitionListNode*)node;
+            list->definitions = (TypeDefinitionNode**)read_node_refs(r, &list->count);
+            for (int i = 0; i < list->count; i++)
+                if (list->definitions[i] && list->definitions[i]->base.type != AST_Node_Type_Definition)
+                    r->failed = true;
+            break;
+        }
+        case AST_Node_New: {
+            NewNode* new_node = (NewNode*)node;
+            new_node->type_name = read_string(r);
+            new_node->args = read_node_refs(r, &new_node->arg_count);
+            break;
+        }
+        case AST_Node_Attribute_Access: {
+            AttributeAccessNode* access = (AttributeAccessNode*)node;
+            access->object = read_node_ref(r);
+            access->attribute_name = read_string(r);
+            access->args = read_node_refs(r, &access->arg_count);
+            access->is_method_call = read_u8(r) != 0;
+            break;
+        }
+    }
+}
+
+static void read_symbols(SnapshotReader* r, SymbolTable* scope) {
+    int count = read_count(r);
+    for (int i = 0; i < count && !r->failed; i++) {
+        char* name = read_string(r);
+        uint32_t kind = read_u32(r);
+        TypeDescriptor* type = read_type_ref(r);
+        ASTNode* value = read_node_ref(r);
+        if (r->failed || !name || kind >= SYMBOL_ANY) {
+            r->failed = true;
+            return;
+        }
+        insert_symbol(scope, create_symbol(name, (SymbolKind)kind, type, value));
+    }
+}
+
+static bool read_snapshot(SnapshotReader* r) {
+    const SnapshotHeader* header = read_bytes(r, sizeof(SnapshotHeader));
+    if (!header || memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0
+        || header->endian_mark != SNAPSHOT_ENDIAN_MARK) {
+        fprintf(stderr, "Error: el archivo no es un snapshot de AST\n");
+        r->failed = false; // Ya se informo
+        return false;
+    }
+    if (header->version != AST_SNAPSHOT_VERSION) {
+        fprintf(stderr, "Error: snapshot de AST con version %u (se esperaba %d)\n", header->version, AST_SNAPSHOT_VERSION);
+        return false;
+    }
+    if (header->base_type_count != (uint32_t)r->type_table->count
+        || header->base_symbol_count != (uint32_t)r->global_scope->size) {
+        fprintf(stderr, "Error: el snapshot de AST se genero con otros tipos o funciones predefinidas\n");
+        return false;
+    }
+    if (header->node_count > header->node_id_limit || header->node_id_limit > r->size
+        || header->scope_count > r->size || header->type_count > r->size) {
+        r->failed = true;
+        return false;
+    }
+
+    CompilationContext* ctx = r->ctx;
+    r->node_id_limit = header->node_id_limit;
+    r->nodes = calloc((size_t)r->node_id_limit + 1, sizeof(ASTNode*));
+    if (!r->nodes) DIE("Out of memory in ast snapshot");
+
+    // Reserva los nodos vacios para que las referencias hacia adelante ya tengan destino
+    for (uint32_t i = 0; i < header->node_count && !r->failed; i++) {
+        uint32_t id = read_u32(r);
+        uint32_t kind = read_u32(r);
+        size_t size = kind <= AST_Node_Attribute_Access ? node_size((ASTNodeType)kind) : 0;
+        if (r->failed || id == 0 || id > r->node_id_limit || r->nodes[id] || size == 0) {
+            r->failed = true;
+            break;
+        }
+        ASTNode* node = arena_calloc(&ctx->arena, 1, size);
+        node->type = (ASTNodeType)kind;
+        node->id = id;
+        r->nodes[id] = node;
+    }
+    // Los ids se conservan; los nodos cargados no tienen posicion en la fuente
+    ctx->ast_node_count = (int)r->node_id_limit;
+
+    for (uint32_t i = 0; i < header->type_count && !r->failed; i++) {
+        char* name = read_string(r);
+        uint32_t tag = read_u32(r);
+        if (!name || tag != HULK_Type_UserDefined || type_table_lookup(r->type_table, name)) {
+            r->failed = true;
+            break;
+        }
+        add_type(r->type_table, create_user_defined_type(name, NULL, NULL, false));
+    }
+
+    r->scope_count = header->scope_count;
+    r->scopes = calloc(r->scope_count ? r->scope_count : 1, sizeof(SymbolTable*));
+    for (uint32_t i = 0; i < r->scope_count; i++)
+        r->scopes[i] = create_symbol_table(r->global_scope);
+
+    for (uint32_t i = 0; i < header->node_count && !r->failed; i++)
+        read_node_body(r);
+
+    for (uint32_t i = 0; i < header->type_count && !r->failed; i++) {
+        TypeDescriptor* type = r->type_table->types[header->base_type_count + i];
+        type->parent = read_type_ref(r);
+        type->initializated = read_u8(r) != 0;
+        if (read_u8(r)) {
+            TypeDefinitionNode* type_def = (TypeDefinitionNode*)read_node_ref_of(r, AST_Node_Type_Definition);
+            SymbolTable* scope = read_scope_ref(r);
+            if (!type_def || !scope) {
+                r->failed = true;
+                break;
+            }
+            type->info = create_type_info(type_def, scope);
+        }
+    }
+
+    for (uint32_t i = 0; i < r->scope_count && !r->failed; i++) {
+        SymbolTable* scope = r->scopes[i];
+        scope->parent = read_scope_ref(r);
+        scope->symbol_counter = r->global_scope->symbol_counter;
+        read_symbols(r, scope);
+    }
+    if (!r->failed)
+        read_symbols(r, r->global_scope);
+
+    if (!r->failed) {
+        ASTNode* program = header->program <= r->node_id_limit ? r->nodes[header->program] : NULL;
+        if (program && program->type == AST_Node_Program)
+            ctx->root_node = program;
+        else
+            r->failed = true;
+    }
+    return !r->failed && r->pos == r->size;
+}
+
+bool ast_snapshot_load(const char* path, CompilationContext* ctx, SymbolTable* global_scope) {
+    SourceBuffer buffer;
+    if (!source_buffer_load(&buffer, path)) {
+        fprintf(stderr, "No se pudo abrir el snapshot de AST '%s'\n", path);
+        return false;
+    }
+
+    SnapshotReader r = { 0 };
+    r.data = (const unsigned char*)buffer.data;
+    r.size = buffer.size;
+    r.ctx = ctx;
+    r.type_table = ctx->type_table;
+    r.global_scope = global_scope;
+
+    bool ok = read_snapshot(&r);
+    if (!ok && r.failed)
+        fprintf(stderr, "Error: snapshot de AST corrupto '%s'\n", path);
+    if (!ok)
+        ctx->root_node = NULL;
+
+    // Los strings quedaron internados: el archivo ya no hace falta
+    free(r.nodes);
+    free(r.scopes);
+    source_buffer_release(&buffer);
+    return ok;
+}
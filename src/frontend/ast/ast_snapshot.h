@@ -0,0 +1,33 @@
+#ifndef AST_SNAPSHOT_H
+#define AST_SNAPSHOT_H
+
+#include "ast.h"
+#include "../hulk_type/type_table.h"
+#include "../scope/symbol_table.h"
+
+// Snapshot binario (.hast) de un programa ya parseado y chequeado: el AST con
+// los tipos inferidos, los tipos definidos por el programa y todos sus scopes.
+// Cargarlo deja el mismo estado que dejan yyparse + semantic_visit, de modo que
+// se puede pasar directo a generate_code.
+//
+// Todos los campos son enteros de ancho fijo en el orden de bytes del host (el
+// loader lo comprueba) y las referencias entre objetos son indices, asi que el
+// archivo se lee mapeado en memoria sin ningun parseo de texto. Los tipos
+// builtin y las funciones predefinidas no se guardan: se referencian por su
+// posicion en el prelude, que debe coincidir al cargar.
+
+// Hay que subirla con cualquier cambio en el formato o en los nodos del AST
+#define AST_SNAPSHOT_VERSION 1
+
+// Escribe el snapshot de 'program'. base_type_count y base_symbol_count son los
+// tipos de type_table y los simbolos de global_scope que habia antes de compilar
+// (los del prelude). Retorna false si no se pudo escribir.
+bool ast_snapshot_write(const char* path, ProgramNode* program, const CompilationContext* ctx,
+                        SymbolTable* global_scope, int base_type_count, int base_symbol_count);
+
+// Reconstruye en ctx (arena y ctx->type_table) y en global_scope el programa
+// guardado en 'path' y lo deja en ctx->root_node. Retorna false si el archivo
+// no existe, esta corrupto o fue generado con otra version o prelude.
+bool ast_snapshot_load(const char* path, CompilationContext* ctx, SymbolTable* global_scope);
+
+#endif // AST_SNAPSHOT_H
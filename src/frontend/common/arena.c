@@ -0,0 +1,85 @@
+#include "arena.h"
+#include <stdalign.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN alignof(max_align_t)
+
+static size_t align_up(size_t size) {
+    return (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+void arena_init(Arena* arena, size_t block_size) {
+    arena->head = NULL;
+    arena->block_size = block_size ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+    arena->bytes_used = 0;
+}
+
+void arena_release(Arena* arena) {
+    ArenaBlock* block = arena->head;
+    while (block) {
+        ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+    arena->bytes_used = 0;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    size = align_up(size ? size : 1);
+
+    ArenaBlock* block = arena->head;
+    if (!block || block->size - block->used < size) {
+        // Las reservas mas grandes que un bloque reciben un bloque propio
+        size_t capacity = size > arena->block_size ? size : arena->block_size;
+        block = malloc(sizeof(ArenaBlock) + capacity);
+        if (!block) return NULL;
+        block->size = capacity;
+        block->used = 0;
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    void* ptr = block->data + block->used;
+    block->used += size;
+    arena->bytes_used += size;
+    return ptr;
+}
+
+void* arena_calloc(Arena* arena, size_t count, size_t size) {
+    void* ptr = arena_alloc(arena, count * size);
+    if (ptr) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+void* arena_realloc(Arena* arena, void* ptr, size_t old_size, size_t new_size) {
+    if (!ptr) return arena_alloc(arena, new_size);
+    if (new_size <= old_size) return ptr;
+
+    // Ultima reserva del bloque actual: basta con mover el final
+    ArenaBlock* block = arena->head;
+    size_t old_aligned = align_up(old_size ? old_size : 1);
+    size_t new_aligned = align_up(new_size);
+    if ((unsigned char*)ptr + old_aligned == block->data + block->used
+        && block->size - block->used >= new_aligned - old_aligned) {
+        block->used += new_aligned - old_aligned;
+        arena->bytes_used += new_aligned - old_aligned;
+        return ptr;
+    }
+
+    void* grown = arena_alloc(arena, new_size);
+    if (grown) memcpy(grown, ptr, old_size);
+    return grown;
+}
+
+char* arena_strdup(Arena* arena, const char* str) {
+    if (!str) return NULL;
+    return arena_memdup(arena, str, strlen(str) + 1);
+}
+
+void* arena_memdup(Arena* arena, const void* src, size_t size) {
+    void* ptr = arena_alloc(arena, size);
+    if (ptr && size) memcpy(ptr, src, size);
+    return ptr;
+}
@@ -0,0 +1,36 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Bloque de memoria de una arena; los objetos se reservan uno detras de otro
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;
+    size_t used;
+    _Alignas(max_align_t) unsigned char data[];
+} ArenaBlock;
+
+// Arena de tipo "bump": reservar es avanzar un puntero y todo se libera de una
+// vez con arena_release. No hay free individual.
+typedef struct Arena {
+    ArenaBlock* head;           // Bloque actual (los anteriores cuelgan de next)
+    size_t block_size;          // Tamano de los bloques nuevos
+    size_t bytes_used;          // Bytes entregados (para --time-report)
+} Arena;
+
+#define ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+void arena_init(Arena* arena, size_t block_size);
+void arena_release(Arena* arena);
+
+// Memoria alineada para cualquier tipo. Retorna NULL solo si malloc falla.
+void* arena_alloc(Arena* arena, size_t size);
+void* arena_calloc(Arena* arena, size_t count, size_t size);
+// Crece 'ptr' (reservado en la arena con old_size bytes). Si es la ultima reserva
+// crece en el sitio; si no, copia a una reserva nueva.
+void* arena_realloc(Arena* arena, void* ptr, size_t old_size, size_t new_size);
+char* arena_strdup(Arena* arena, const char* str);
+void* arena_memdup(Arena* arena, const void* src, size_t size);
+
+#endif // ARENA_H
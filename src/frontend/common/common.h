@@ -5,15 +5,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "intern.h"
+#include "fatal.h"
 
 // Foward Declaration
 typedef struct ASTNode ASTNode;
 
-// Variables globales del compilador
+// Tabla constante de nombres de operadores (el estado de cada compilacion vive en CompilationContext)
 extern const char *Hulk_Op_Names[] ;
-extern int line_num;
-extern char current_line[];
-extern int semantic_error_count;
 typedef enum {
     HULK_Type_Undefined, HULK_Type_Null,
     HULK_Type_Number, HULK_Type_String, HULK_Type_Boolean,
@@ -36,8 +35,7 @@ typedef enum {
     SYMBOL_ANY,
 } SymbolKind;
 
-void report_semantic_error(ASTNode* node, const char* fmt, ...);
 
-#define DIE(msg) do { fprintf(stderr, "Error: %s\n", msg); exit(EXIT_FAILURE); } while (0)
+#define DIE(msg) do { fprintf(stderr, "Error: %s\n", msg); compilation_fatal(EXIT_FAILURE); } while (0)
 
 #endif
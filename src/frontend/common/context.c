@@ -0,0 +1,46 @@
+#include "context.h"
+#include "../hulk_type/type_table.h"
+#include <stdlib.h>
+#include <string.h>
+
+void init_compilation_context(CompilationContext* ctx, TypeTable* type_table, const char* source_name) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->type_table = type_table;
+    ctx->builtins = &type_table->builtins;
+    ctx->loc.line = 1;
+    ctx->loc.column = 1;
+    arena_init(&ctx->arena, ARENA_DEFAULT_BLOCK_SIZE);
+    source_file_init(&ctx->source, source_name);
+}
+
+void free_compilation_context(CompilationContext* ctx) {
+    arena_release(&ctx->arena);
+    free(ctx->node_locs);
+    ctx->node_locs = NULL;
+    ctx->node_loc_capacity = 0;
+    source_file_free(&ctx->source);
+    ctx->root_node = NULL;
+}
+
+uint32_t context_add_node_loc(CompilationContext* ctx, SourceLoc loc) {
+    uint32_t id = (uint32_t)++ctx->ast_node_count;
+    if (id >= ctx->node_loc_capacity) {
+        uint32_t capacity = ctx->node_loc_capacity ? ctx->node_loc_capacity * 2 : 1024;
+        SourceLoc* locs = realloc(ctx->node_locs, capacity * sizeof(SourceLoc));
+        if (!locs) {
+            fprintf(stderr, "Error: memoria insuficiente para las posiciones del AST\n");
+            compilation_fatal(1);
+        }
+        locs[0] = (SourceLoc){ 0 };    // AST_NO_LOC
+        ctx->node_locs = locs;
+        ctx->node_loc_capacity = capacity;
+    }
+    ctx->node_locs[id] = loc;
+    return id;
+}
+
+SourceLoc context_node_loc(const CompilationContext* ctx, uint32_t id) {
+    if (!ctx || !ctx->node_locs || id == 0 || id >= ctx->node_loc_capacity || id > (uint32_t)ctx->ast_node_count)
+        return (SourceLoc){ 0 };
+    return ctx->node_locs[id];
+}
@@ -0,0 +1,47 @@
+#ifndef CONTEXT_H
+#define CONTEXT_H
+
+#include "arena.h"
+#include "source.h"
+
+// Foward declarations
+typedef struct ASTNode ASTNode;
+typedef struct TypeTable TypeTable;
+typedef struct BuiltinTypes BuiltinTypes;
+typedef struct SymbolTable SymbolTable;
+
+typedef struct CompilationContext {
+    // Estado de una compilacion. El parser y el lexer son reentrantes y solo
+    // escriben aqui. type_table y global_scope son copias propias del prelude,
+    // asi que cada fase escribe solo en tablas de esta compilacion; lo unico
+    // compartido entre hilos es la tabla de strings internados (intern.h).
+    TypeTable* type_table;      // Tipos builtin mas los tipos del programa
+    SymbolTable* global_scope;  // Funciones predefinidas mas las del programa
+    const BuiltinTypes* builtins; // Tipos builtin de type_table, para los constructores del AST
+    ASTNode* root_node;         // Resultado del parser
+    Arena arena;                // Nodos, Params y VariableAssigments del AST
+    SourceFile source;          // Texto que escanea el lexer
+    SourceLoc loc;              // Posicion del ultimo token leido
+    uint32_t offset;            // Bytes consumidos por el lexer
+    SourceLoc* node_locs;       // Posicion de cada nodo del AST, indexada por ASTNode::id
+    uint32_t node_loc_capacity;
+    int ast_node_count;         // Nodos creados (para --time-report)
+    int symbol_count;           // Simbolos insertados en los scopes (para --time-report)
+} CompilationContext;
+
+// source_name solo se usa en los diagnosticos
+void init_compilation_context(CompilationContext* ctx, TypeTable* type_table, const char* source_name);
+// Libera de una vez todo el AST y el texto fuente de la compilacion
+void free_compilation_context(CompilationContext* ctx);
+
+// Registra la posicion de un nodo nuevo y retorna su id (empiezan en 1)
+uint32_t context_add_node_loc(CompilationContext* ctx, SourceLoc loc);
+// Posicion del nodo 'id'; linea 0 si el nodo no tiene posicion
+SourceLoc context_node_loc(const CompilationContext* ctx, uint32_t id);
+
+// Parsea la fuente en el sitio con un scanner propio y deja el AST en ctx->root_node
+// (definida en lexer.l). El buffer debe seguir vivo mientras se use el AST o el
+// SourceFile. Retorna 0 si el parseo fue exitoso.
+int parse_hulk_program(SourceBuffer* buffer, CompilationContext* ctx);
+
+#endif // CONTEXT_H
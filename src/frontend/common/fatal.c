@@ -0,0 +1,32 @@
+#include "fatal.h"
+#include <setjmp.h>
+#include <stdlib.h>
+
+typedef struct FatalGuard {
+    jmp_buf env;
+    int code;
+} FatalGuard;
+
+static _Thread_local FatalGuard* current_guard;   // Punto de recuperacion del hilo (NULL = ninguno)
+
+void compilation_fatal(int code) {
+    if (!current_guard)
+        exit(code);
+    current_guard->code = code;
+    longjmp(current_guard->env, 1);
+}
+
+int run_guarded(int (*run)(void* arg), void* arg) {
+    FatalGuard guard;
+    FatalGuard* outer = current_guard;
+    current_guard = &guard;
+
+    int code;
+    if (setjmp(guard.env) == 0)
+        code = run(arg);
+    else
+        code = guard.code;
+
+    current_guard = outer;
+    return code;
+}
@@ -0,0 +1,16 @@
+#ifndef FATAL_H
+#define FATAL_H
+
+// Errores que cortan la compilacion en curso (redefiniciones, tipos desconocidos,
+// memoria agotada...). Dentro de run_guarded vuelven al punto de recuperacion de
+// ese hilo; fuera de el terminan el proceso como un exit.
+
+// Corta la compilacion con 'code' como codigo de salida
+_Noreturn void compilation_fatal(int code);
+
+// Ejecuta run(arg) y retorna lo que retorne. Si dentro se llama a compilation_fatal,
+// retorna su codigo. Lo que se reservo despues del punto de recuperacion queda a cargo
+// de quien llama. Cada hilo tiene su propio punto; se pueden anidar.
+int run_guarded(int (*run)(void* arg), void* arg);
+
+#endif // FATAL_H
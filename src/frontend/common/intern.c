@@ -0,0 +1,125 @@
+#include "intern.h"
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+// Cabecera guardada justo antes de los caracteres de cada string internado
+typedef struct InternedHeader {
+    uint32_t hash;
+    uint32_t length;
+} InternedHeader;
+
+typedef struct InternTable {
+    char** slots;     // Direccionamiento abierto con sondeo lineal; NULL = libre
+    size_t capacity;        // Potencia de 2
+    size_t count;
+    Arena storage;
+} InternTable;
+
+static InternTable table;
+static InternedNames names;
+static pthread_once_t table_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t table_lock = PTHREAD_MUTEX_INITIALIZER;   // Protege table
+
+#define INTERN_INITIAL_CAPACITY 1024
+
+static uint32_t hash_bytes(const char* str, size_t length) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)str[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static const InternedHeader* header_of(const char* interned) {
+    return (const InternedHeader*)interned - 1;
+}
+
+static void grow_table(void) {
+    size_t capacity = table.capacity * 2;
+    char** slots = calloc(capacity, sizeof(char*));
+    for (size_t i = 0; i < table.capacity; i++) {
+        char* str = table.slots[i];
+        if (!str) continue;
+        size_t index = header_of(str)->hash & (capacity - 1);
+        while (slots[index])
+            index = (index + 1) & (capacity - 1);
+        slots[index] = str;
+    }
+    free(table.slots);
+    table.slots = slots;
+    table.capacity = capacity;
+}
+
+// Busca o agrega el string; se llama con table_lock tomado (o desde create_table)
+static char* intern_locked(const char* str, size_t length) {
+    uint32_t hash = hash_bytes(str, length);
+    size_t index = hash & (table.capacity - 1);
+    for (char* candidate; (candidate = table.slots[index]) != NULL; index = (index + 1) & (table.capacity - 1)) {
+        const InternedHeader* header = header_of(candidate);
+        if (header->hash == hash && header->length == length && memcmp(candidate, str, length) == 0)
+            return candidate;
+    }
+
+    InternedHeader* header = arena_alloc(&table.storage, sizeof(InternedHeader) + length + 1);
+    header->hash = hash;
+    header->length = (uint32_t)length;
+    char* interned = (char*)(header + 1);
+    memcpy(interned, str, length);
+    interned[length] = '\0';
+
+    table.slots[index] = interned;
+    table.count++;
+    if (table.count * 2 > table.capacity)
+        grow_table();
+    return interned;
+}
+
+static void create_table(void) {
+    table.capacity = INTERN_INITIAL_CAPACITY;
+    table.count = 0;
+    table.slots = calloc(table.capacity, sizeof(char*));
+    arena_init(&table.storage, ARENA_DEFAULT_BLOCK_SIZE);
+
+    names.self = intern_locked("self", 4);
+    names.this_ = intern_locked("this", 4);
+    names.object = intern_locked("Object", 6);
+    names.undefined = intern_locked("Undefined", 9);
+    names.print = intern_locked("print", 5);
+    names.sqrt = intern_locked("sqrt", 4);
+    names.sin = intern_locked("sin", 3);
+    names.cos = intern_locked("cos", 3);
+    names.exp = intern_locked("exp", 3);
+    names.log = intern_locked("log", 3);
+    names.pow = intern_locked("pow", 3);
+    names.fmod = intern_locked("fmod", 4);
+    names.rand = intern_locked("rand", 4);
+}
+
+void intern_init(void) {
+    pthread_once(&table_once, create_table);
+}
+
+const InternedNames* interned_names(void) {
+    intern_init();
+    return &names;
+}
+
+char* intern_string_n(const char* str, size_t length) {
+    intern_init();
+    pthread_mutex_lock(&table_lock);
+    char* interned = intern_locked(str, length);
+    pthread_mutex_unlock(&table_lock);
+    return interned;
+}
+
+char* intern_string(const char* str) {
+    return str ? intern_string_n(str, strlen(str)) : NULL;
+}
+
+uint32_t interned_hash(const char* interned) {
+    return header_of(interned)->hash;
+}
@@ -0,0 +1,44 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tabla global de strings internados. Cada nombre distinto (identificadores,
+// tipos, parametros, literales) se guarda una sola vez y se identifica por su
+// puntero canonico: dos nombres internados son iguales si y solo si sus punteros
+// son iguales, sin strcmp. Los strings viven hasta el final del proceso.
+// Se puede internar desde varios hilos a la vez (la tabla tiene un lock); los
+// punteros canonicos y su hash no cambian, asi que leerlos no necesita el lock.
+
+// Retorna el puntero canonico de 'str' (lo agrega si no existia). El texto
+// devuelto no se debe modificar ni liberar.
+char* intern_string(const char* str);
+char* intern_string_n(const char* str, size_t length);
+
+// Hash calculado al internar (solo para punteros canonicos)
+uint32_t interned_hash(const char* interned);
+
+// Nombres que el compilador compara a menudo, internados de antemano
+typedef struct InternedNames {
+    char* self;
+    char* this_;
+    char* object;
+    char* undefined;
+    // Funciones builtin que codegen reconoce por nombre
+    char* print;
+    char* sqrt;
+    char* sin;
+    char* cos;
+    char* exp;
+    char* log;
+    char* pow;
+    char* fmod;
+    char* rand;
+} InternedNames;
+
+// Crea la tabla y rellena los nombres conocidos (idempotente)
+void intern_init(void);
+const InternedNames* interned_names(void);
+
+#endif // INTERN_H
@@ -0,0 +1,85 @@
+#include "log.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+LogLevel log_levels[LOG_CAT_COUNT] = {
+    LOG_LEVEL_WARN, LOG_LEVEL_WARN, LOG_LEVEL_WARN, LOG_LEVEL_WARN
+};
+
+static const char* category_names[LOG_CAT_COUNT] = {
+    [LOG_CAT_DRIVER] = "driver",
+    [LOG_CAT_PARSER] = "parser",
+    [LOG_CAT_SEMANTIC] = "semantic",
+    [LOG_CAT_CODEGEN] = "codegen",
+};
+
+static const char* level_names[] = {
+    [LOG_LEVEL_ERROR] = "error",
+    [LOG_LEVEL_WARN] = "warn",
+    [LOG_LEVEL_INFO] = "info",
+    [LOG_LEVEL_DEBUG] = "debug",
+    [LOG_LEVEL_TRACE] = "trace",
+};
+
+void log_message(LogCategory category, LogLevel level, const char* fmt, ...) {
+    // Los mensajes van a stderr para no mezclarse con la salida del programa (--run)
+    fprintf(stderr, "[%s:%s] ", category_names[category], level_names[level]);
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+void log_set_verbosity(int verbosity) {
+    LogLevel level = LOG_LEVEL_WARN + verbosity;
+    if (level > LOG_LEVEL_TRACE) level = LOG_LEVEL_TRACE;
+    for (int i = 0; i < LOG_CAT_COUNT; i++)
+        if (log_levels[i] < level)
+            log_levels[i] = level;
+}
+
+static bool parse_level(const char* name, size_t len, LogLevel* level) {
+    for (int i = LOG_LEVEL_ERROR; i <= LOG_LEVEL_TRACE; i++) {
+        if (strlen(level_names[i]) == len && strncmp(level_names[i], name, len) == 0) {
+            *level = (LogLevel)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool configure_item(const char* item, size_t len) {
+    const char* colon = memchr(item, ':', len);
+    size_t name_len = colon ? (size_t)(colon - item) : len;
+    LogLevel level = LOG_LEVEL_DEBUG;
+
+    if (colon && !parse_level(colon + 1, len - name_len - 1, &level)) {
+        fprintf(stderr, "Nivel de log desconocido '%.*s'\n", (int)(len - name_len - 1), colon + 1);
+        return false;
+    }
+    if (name_len == 3 && strncmp(item, "all", 3) == 0) {
+        for (int i = 0; i < LOG_CAT_COUNT; i++)
+            log_levels[i] = level;
+        return true;
+    }
+    for (int i = 0; i < LOG_CAT_COUNT; i++) {
+        if (strlen(category_names[i]) == name_len && strncmp(category_names[i], item, name_len) == 0) {
+            log_levels[i] = level;
+            return true;
+        }
+    }
+    fprintf(stderr, "Categoria de log desconocida '%.*s' (driver, parser, semantic, codegen, all)\n", (int)name_len, item);
+    return false;
+}
+
+bool log_configure(const char* spec) {
+    while (*spec) {
+        const char* comma = strchr(spec, ',');
+        size_t len = comma ? (size_t)(comma - spec) : strlen(spec);
+        if (len > 0 && !configure_item(spec, len))
+            return false;
+        spec += comma ? len + 1 : len;
+    }
+    return true;
+}
@@ -0,0 +1,68 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdbool.h>
+
+// Niveles de log. Los valores son fijos porque HULK_LOG_MAX_LEVEL los compara en el preprocesador.
+typedef enum LogLevel {
+    LOG_LEVEL_ERROR = 0,
+    LOG_LEVEL_WARN  = 1,
+    LOG_LEVEL_INFO  = 2,
+    LOG_LEVEL_DEBUG = 3,
+    LOG_LEVEL_TRACE = 4
+} LogLevel;
+
+// Subsistemas que se pueden activar por separado con --log=<categoria>
+typedef enum LogCategory {
+    LOG_CAT_DRIVER,
+    LOG_CAT_PARSER,
+    LOG_CAT_SEMANTIC,
+    LOG_CAT_CODEGEN,
+    LOG_CAT_COUNT
+} LogCategory;
+
+// Nivel maximo compilado. En release (make RELEASE=1) vale 1 y las llamadas
+// de nivel info/debug/trace desaparecen del binario sin evaluar argumentos.
+#ifndef HULK_LOG_MAX_LEVEL
+#define HULK_LOG_MAX_LEVEL 4
+#endif
+
+// Nivel activo de cada categoria (por defecto solo warnings y errores)
+extern LogLevel log_levels[LOG_CAT_COUNT];
+
+void log_message(LogCategory category, LogLevel level, const char* fmt, ...)
+    __attribute__((format(printf, 3, 4)));
+
+// -v, -vv, -vvv: sube el nivel de todas las categorias
+void log_set_verbosity(int verbosity);
+// --log=codegen,semantic:trace  (categoria[:nivel], nivel por defecto debug; "all" para todas)
+bool log_configure(const char* spec);
+
+#define LOG_ENABLED(category, level) \
+    ((level) <= HULK_LOG_MAX_LEVEL && (level) <= log_levels[(category)])
+
+#define HULK_LOG(category, level, ...) \
+    do { if (LOG_ENABLED(category, level)) log_message((category), (level), __VA_ARGS__); } while (0)
+
+#define LOG_ERROR(category, ...) HULK_LOG(category, LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(category, ...)  HULK_LOG(category, LOG_LEVEL_WARN, __VA_ARGS__)
+
+#if HULK_LOG_MAX_LEVEL >= 2
+#define LOG_INFO(category, ...)  HULK_LOG(category, LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(category, ...)  ((void)0)
+#endif
+
+#if HULK_LOG_MAX_LEVEL >= 3
+#define LOG_DEBUG(category, ...) HULK_LOG(category, LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#if HULK_LOG_MAX_LEVEL >= 4
+#define LOG_TRACE(category, ...) HULK_LOG(category, LOG_LEVEL_TRACE, __VA_ARGS__)
+#else
+#define LOG_TRACE(category, ...) ((void)0)
+#endif
+
+#endif // LOG_H
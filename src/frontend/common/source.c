@@ -0,0 +1,146 @@
+#include "source.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool source_buffer_map_file(SourceBuffer* buffer, const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+
+    // Se reserva una region anonima con espacio para los dos '\0' finales y el archivo
+    // se mapea encima; asi el relleno existe aunque el tamano sea multiplo de pagina.
+    size_t size = (size_t)st.st_size;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t mapped_size = (size + 2 + page - 1) / page * page;
+    char* data = mmap(NULL, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+    if (size > 0 && mmap(data, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(data, mapped_size);
+        close(fd);
+        return false;
+    }
+    close(fd);
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    data[size] = '\0';
+    data[size + 1] = '\0';
+    buffer->data = data;
+    buffer->size = size;
+    buffer->mapped_size = mapped_size;
+    buffer->kind = SOURCE_BUFFER_MAPPED;
+    return true;
+}
+
+bool source_buffer_read_stream(SourceBuffer* buffer, FILE* stream) {
+    size_t capacity = 4096;
+    size_t size = 0;
+    char* data = malloc(capacity);
+    size_t n;
+    while (data && (n = fread(data + size, 1, capacity - size - 2, stream)) > 0) {
+        size += n;
+        if (capacity - size - 2 == 0) {
+            capacity *= 2;
+            char* grown = realloc(data, capacity);
+            if (!grown) free(data);
+            data = grown;
+        }
+    }
+    if (!data || ferror(stream)) {
+        free(data);
+        return false;
+    }
+    data[size] = '\0';
+    data[size + 1] = '\0';
+    buffer->data = data;
+    buffer->size = size;
+    buffer->mapped_size = 0;
+    buffer->kind = SOURCE_BUFFER_HEAP;
+    return true;
+}
+
+bool source_buffer_load(SourceBuffer* buffer, const char* path) {
+    if (!path)
+        return source_buffer_read_stream(buffer, stdin);
+    if (source_buffer_map_file(buffer, path))
+        return true;
+
+    FILE* stream = fopen(path, "r");
+    if (!stream) return false;
+    bool ok = source_buffer_read_stream(buffer, stream);
+    fclose(stream);
+    return ok;
+}
+
+void source_buffer_borrow(SourceBuffer* buffer, char* data, size_t size) {
+    buffer->data = data;
+    buffer->size = size;
+    buffer->mapped_size = 0;
+    buffer->kind = SOURCE_BUFFER_BORROWED;
+}
+
+void source_buffer_release(SourceBuffer* buffer) {
+    if (buffer->kind == SOURCE_BUFFER_MAPPED)
+        munmap(buffer->data, buffer->mapped_size);
+    else if (buffer->kind == SOURCE_BUFFER_HEAP)
+        free(buffer->data);
+    buffer->data = NULL;
+    buffer->size = 0;
+}
+
+
+void source_file_init(SourceFile* file, const char* name) {
+    memset(file, 0, sizeof(*file));
+    file->name = name;
+}
+
+void source_file_free(SourceFile* file) {
+    free(file->line_offsets);
+    memset(file, 0, sizeof(*file));
+}
+
+void source_file_set_text(SourceFile* file, const char* text, size_t size) {
+    file->text = text;
+    file->size = size;
+
+    // Primera pasada: contar lineas para reservar la tabla exacta
+    int lines = 1;
+    for (const char* p = text; (p = memchr(p, '\n', (size_t)(text + size - p))) != NULL; p++)
+        lines++;
+
+    free(file->line_offsets);
+    file->line_offsets = malloc(sizeof(uint32_t) * lines);
+    file->line_offsets[0] = 0;
+    file->line_count = 1;
+    for (const char* p = text; (p = memchr(p, '\n', (size_t)(text + size - p))) != NULL; p++)
+        file->line_offsets[file->line_count++] = (uint32_t)(p - text) + 1;
+}
+
+void source_file_locate(const SourceFile* file, uint32_t offset, SourceLoc* loc) {
+    if (loc->line == 0) loc->line = 1;
+    while ((int)loc->line < file->line_count && file->line_offsets[loc->line] <= offset)
+        loc->line++;
+    uint32_t column = offset - file->line_offsets[loc->line - 1] + 1;
+    loc->offset = offset;
+    loc->column = column < UINT16_MAX ? (uint16_t)column : UINT16_MAX;
+}
+
+const char* source_file_line(const SourceFile* file, uint32_t line, size_t* length) {
+    if (line == 0 || (int)line > file->line_count || !file->text)
+        return NULL;
+    size_t start = file->line_offsets[line - 1];
+    size_t end = (int)line < file->line_count ? file->line_offsets[line] - 1 : file->size;
+    if (end > start && file->text[end - 1] == '\r') end--;
+    *length = end - start;
+    return file->text + start;
+}
@@ -0,0 +1,64 @@
+#ifndef SOURCE_H
+#define SOURCE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Posicion compacta de un nodo en la fuente. El texto de la linea no se guarda
+// en cada nodo: se reconstruye desde el SourceFile solo al reportar un error.
+typedef struct SourceLoc {
+    uint32_t offset;        // Byte de inicio dentro del archivo
+    uint32_t line;          // Linea (desde 1; 0 si el nodo no viene de la fuente)
+    uint16_t column;        // Columna (desde 1, saturada en 65535)
+} SourceLoc;
+
+// Fuente completa en memoria, terminada en dos '\0' como pide yy_scan_buffer.
+// Los archivos se mapean con mmap (copy-on-write: flex escribe terminadores
+// temporales en el buffer) y se escanean en el sitio.
+typedef enum {
+    SOURCE_BUFFER_BORROWED,     // Memoria del llamador
+    SOURCE_BUFFER_HEAP,         // malloc
+    SOURCE_BUFFER_MAPPED,       // mmap
+} SourceBufferKind;
+
+typedef struct SourceBuffer {
+    char* data;
+    size_t size;                // Bytes de la fuente (sin los dos '\0')
+    size_t mapped_size;
+    SourceBufferKind kind;
+} SourceBuffer;
+
+bool source_buffer_map_file(SourceBuffer* buffer, const char* path);
+bool source_buffer_read_stream(SourceBuffer* buffer, FILE* stream);
+// Mapea 'path' o, si no es un archivo regular (tuberia, /dev/stdin), lo lee entero.
+// Con path NULL lee stdin.
+bool source_buffer_load(SourceBuffer* buffer, const char* path);
+// 'data' debe tener size + 2 bytes con los dos ultimos en '\0'; no se copia
+void source_buffer_borrow(SourceBuffer* buffer, char* data, size_t size);
+void source_buffer_release(SourceBuffer* buffer);
+
+// Texto de un archivo fuente (prestado del SourceBuffer) mas el indice de inicio de cada linea
+typedef struct SourceFile {
+    const char* name;
+    const char* text;
+    size_t size;
+    uint32_t* line_offsets;     // line_offsets[i] = offset del inicio de la linea i + 1
+    int line_count;
+} SourceFile;
+
+void source_file_init(SourceFile* file, const char* name);
+void source_file_free(SourceFile* file);
+
+// Asocia el texto y construye la tabla de inicios de linea en una pasada
+void source_file_set_text(SourceFile* file, const char* text, size_t size);
+
+// Actualiza 'loc' para un token que empieza en 'offset'. Avanza desde loc->line, asi
+// que recorrer los tokens en orden cuesta O(1) amortizado por token.
+void source_file_locate(const SourceFile* file, uint32_t offset, SourceLoc* loc);
+
+// Texto de la linea 'line' (sin el salto de linea). Retorna NULL si la linea no existe.
+const char* source_file_line(const SourceFile* file, uint32_t line, size_t* length);
+
+#endif // SOURCE_H
@@ -1,4 +1,5 @@
 #include "hulk_type.h"
+#include "type_table.h"
 #include "../ast/ast.h"
 
 TypeDescriptor* create_builtin_type(HULK_Type tag, const char *type_name, TypeDescriptor* parent) {
@@ -6,13 +7,16 @@ TypeDescriptor* create_builtin_type(HULK_Type tag, const char *type_name, TypeDe
     TypeDescriptor *type = malloc(sizeof(TypeDescriptor));
     if (!type) return NULL; 
     
-    type->type_name = strdup(type_name);
+    type->type_name = intern_string(type_name);
     type->tag = tag;
     type->info = NULL;      
     type->parent = parent;
     type->initializated = true;
     type->llvm_type = NULL;
     type->type_id = 0; 
+    type->table = NULL;
+    type->hierarchy_first = type->hierarchy_last = 0;
+    type->hierarchy_epoch = 0;
     return type;
 }
 
@@ -22,13 +26,16 @@ TypeDescriptor* create_user_defined_type(const char *name, TypeInfo* info, TypeD
     if (!type)
         return NULL; // Error al asignar memoria
     
-    type->type_name = strdup(name);
+    type->type_name = intern_string(name);
     type->tag = HULK_Type_UserDefined;
     type->info = info;
     type->parent = parent;
     type->initializated = init;    
     type->llvm_type = NULL;  
     type->type_id = 0;
+    type->table = NULL;
+    type->hierarchy_first = type->hierarchy_last = 0;
+    type->hierarchy_epoch = 0;
     return type;
 }
 
@@ -40,7 +47,7 @@ TypeInfo* create_type_info( TypeDefinitionNode* type_def, SymbolTable* scope ) {
         info->param_count = type_def->param_count;
         info->params_name = malloc(type_def->param_count * sizeof(char*));
         for (int i = 0; i < type_def->param_count; i++)
-            info->params_name[i] = strdup(type_def->params[i]->name);
+            info->params_name[i] = type_def->params[i]->name; // Ya internado por el lexer
     } 
     else {
         info->param_count = 0;
@@ -51,16 +58,30 @@ TypeInfo* create_type_info( TypeDefinitionNode* type_def, SymbolTable* scope ) {
     return info;
 }
 
+// Los intervalos solo se comparan entre tipos de la misma tabla y numerados en
+// su epoca actual (number_type_hierarchy)
+static bool hierarchy_numbered(TypeDescriptor* t1, TypeDescriptor* t2) {
+    TypeTable* table = t1->table;
+    return table && t2->table == table
+        && t1->hierarchy_epoch == table->hierarchy_epoch && t2->hierarchy_epoch == table->hierarchy_epoch;
+}
+
 void modify_type(TypeDescriptor* t, TypeInfo* info, TypeDescriptor* parent, bool init ) {
     // Modifica los valores de un tipo
     if (info) t->info = info;
-    if (parent) t->parent = parent;
+    if (parent && parent != t->parent) {
+        t->parent = parent;
+        if (t->table)
+            t->table->hierarchy_epoch++;  // Un tipo declarado por adelantado cambio de lugar en el arbol
+    }
     if (init) t->initializated = init;
 }
 
 bool inherits_from(TypeDescriptor* t1, TypeDescriptor* t2) {
     // Retorna true si t1 hereda de t2
     if (!t1 || !t2 || t1 == t2) return false;
+    if (hierarchy_numbered(t1, t2))
+        return t2->hierarchy_first < t1->hierarchy_first && t1->hierarchy_first <= t2->hierarchy_last;
 
     TypeDescriptor* current = t1->parent;
     while (current) {
@@ -74,6 +95,8 @@ bool inherits_from(TypeDescriptor* t1, TypeDescriptor* t2) {
 bool conforms(TypeDescriptor* t1, TypeDescriptor* t2) {
     // Retorna true si t1 conforma t2
     if (!t1 || !t2) return false;
+    if (hierarchy_numbered(t1, t2))
+        return t2->hierarchy_first <= t1->hierarchy_first && t1->hierarchy_first <= t2->hierarchy_last;
     return cmp_type(t1, t2) || inherits_from(t1, t2);
 }
 
@@ -82,7 +105,7 @@ bool cmp_type(TypeDescriptor* t1, TypeDescriptor* t2) {
     if (t1 == NULL || t2 == NULL) return false;
 
     if (t1->tag == HULK_Type_UserDefined && t2->tag == HULK_Type_UserDefined) {
-        return strcmp(t1->type_name, t2->type_name) == 0;
+        return t1->type_name == t2->type_name;
     }
 
     return t1->tag == t2->tag;
@@ -91,7 +114,6 @@ bool cmp_type(TypeDescriptor* t1, TypeDescriptor* t2) {
 void free_type_descriptor(TypeDescriptor *type) {
     // Libera la memoria de un TypeDescriptor.
     if (type) {
-        free(type->type_name); // Libera el nombre del tipo
         if (type->info) 
             free_type_info(type->info);
         free(type);
@@ -102,6 +124,7 @@ void free_type_info(TypeInfo *info) {
     // Libera la memoria asociada a TypeInfo.
     if (!info) return ;
                 
-    // TODO: implementar liberación de la tabla de simbolos
+    // El scope del tipo es hijo del scope global y se libera con el
+    free(info->params_name);
     free(info);   
 }
@@ -12,6 +12,7 @@ typedef struct ASTNode ASTNode;
 typedef struct SymbolTable SymbolTable;
 typedef struct Param Param;
 typedef struct TypeDefinitionNode TypeDefinitionNode;
+typedef struct TypeTable TypeTable;
 
 typedef struct TypeDescriptor {
     // Describe un tipo de dato en el lenguaje Hulk.
@@ -22,6 +23,13 @@ typedef struct TypeDescriptor {
     bool initializated;             // Especifica si el tipo ya ha sido inicializado(para tipos del usuario)
     LLVMTypeRef llvm_type;          // Referencia al tipo de dato en LLVM, NULL si no se ha generado
     int type_id;               // Identificador único del tipo, se usa para identificar tipos en el compilador
+    TypeTable* table;               // Tabla que le asigno type_id (NULL hasta add_type)
+    // Intervalo del tipo en un recorrido en preorden del arbol de herencia: los
+    // descendientes de t son los tipos con hierarchy_first en (t.first, t.last].
+    // Solo vale si hierarchy_epoch coincide con table->hierarchy_epoch.
+    int hierarchy_first;
+    int hierarchy_last;
+    unsigned hierarchy_epoch;
 } TypeDescriptor;
 
 typedef struct TypeInfo {
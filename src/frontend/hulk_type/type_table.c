@@ -23,16 +23,71 @@ TypeTable *create_type_table() {
     table->count = 0;
     table->capacity = INITIAL_CAPACITY;
     table->types = malloc(sizeof(TypeDescriptor *) * table->capacity);
+    table->index_capacity = INITIAL_CAPACITY * 2;
+    table->index = calloc(table->index_capacity, sizeof(int));
+    memset(&table->builtins, 0, sizeof(table->builtins));
+    table->hierarchy_epoch = 1;
     return table;
 }
 
+// El tipo de 'table' con el mismo type_id que 'type' (de la tabla copiada)
+static TypeDescriptor* copied_type(TypeTable* table, const TypeDescriptor* type) {
+    return type ? table->types[type->type_id] : NULL;
+}
+
+TypeTable* copy_type_table(const TypeTable* base) {
+    TypeTable* table = create_type_table();
+    for (int i = 0; i < base->count; i++) {
+        const TypeDescriptor* type = base->types[i];
+        if (type->info) DIE("copy_type_table: la tabla base solo puede tener tipos builtin");
+        // Los padres van antes que los hijos en la tabla del prelude
+        add_type(table, create_builtin_type(type->tag, type->type_name, copied_type(table, type->parent)));
+    }
+
+    BuiltinTypes* handles = &table->builtins;
+    handles->object = copied_type(table, base->builtins.object);
+    handles->number = copied_type(table, base->builtins.number);
+    handles->boolean = copied_type(table, base->builtins.boolean);
+    handles->string = copied_type(table, base->builtins.string);
+    handles->null = copied_type(table, base->builtins.null);
+    handles->undefined = copied_type(table, base->builtins.undefined);
+    handles->error = copied_type(table, base->builtins.error);
+    return table;
+}
+
+// Slot del indice donde esta (o iria) el nombre internado 'name'
+static int index_slot(TypeTable* table, const char* name) {
+    int mask = table->index_capacity - 1;
+    int slot = (int)(interned_hash(name) & (uint32_t)mask);
+    while (table->index[slot] && table->types[table->index[slot] - 1]->type_name != name)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+static void index_type(TypeTable* table, TypeDescriptor* type) {
+    int slot = index_slot(table, type->type_name);
+    if (!table->index[slot])    // Con nombres repetidos gana el primero, como en la busqueda lineal
+        table->index[slot] = type->type_id + 1;
+}
+
 void add_type(TypeTable *table, TypeDescriptor *type) {
     if (table->count == table->capacity) {
         table->capacity *= 2;
         table->types = realloc(table->types, sizeof(TypeDescriptor *) * table->capacity);
     }
     type->type_id = table->count; // Asignar un ID único al tipo
+    type->table = table;
     table->types[table->count++] = type;
+
+    if (table->count * 2 > table->index_capacity) {
+        free(table->index);
+        table->index_capacity *= 2;
+        table->index = calloc(table->index_capacity, sizeof(int));
+        if (!table->index) DIE("Out of memory in type table");
+        for (int i = 0; i < table->count; i++)
+            index_type(table, table->types[i]);
+    } else
+        index_type(table, type);
 }
 
 void add_user_defined_type(TypeTable* table, TypeDefinitionNode* type_def_node, SymbolTable* current_scope) {
@@ -40,7 +95,7 @@ void add_user_defined_type(TypeTable* table, TypeDefinitionNode* type_def_node,
 
     TypeDescriptor* A = type_table_lookup(table, type_def_node->type_name);
     TypeDescriptor* B = type_table_lookup(table, type_def_node->parent_name);
-    TypeDescriptor* object_type = type_table_lookup(table, "Object");
+    TypeDescriptor* object_type = table->builtins.object;
 
     // Crear el scope del tipo, con el scope actual como padre
     SymbolTable* type_scope = create_symbol_table(current_scope);
@@ -60,7 +115,7 @@ void add_user_defined_type(TypeTable* table, TypeDefinitionNode* type_def_node,
     if(inherits_from(B,A))
     {
         fprintf(stderr, "Error: Detected circular hierachy dependency between types \"%s\" and \"%s\" \n", type_def_node->type_name, type_def_node->parent_name);
-        exit(1);
+        compilation_fatal(1);
     }
 
     if(A)   // si A se encuentra en la tabla
@@ -68,7 +123,7 @@ void add_user_defined_type(TypeTable* table, TypeDefinitionNode* type_def_node,
         if(A->initializated)    // A ya habia sido definido
         {
             fprintf(stderr, "Error: Detected redefinition of type \"%s\" \n", type_def_node->type_name);
-            exit(1);
+            compilation_fatal(1);
         }
         
         modify_type(A, info, B, true);   // modificar A  para que herede de B
@@ -80,17 +135,73 @@ void add_user_defined_type(TypeTable* table, TypeDefinitionNode* type_def_node,
     }   
 }
 
+void number_type_hierarchy(TypeTable* table) {
+    // Recorrido en preorden del bosque de herencia (raices: Object y _Error)
+    int n = table->count;
+    int* first_child = malloc(sizeof(int) * n);
+    int* next_sibling = malloc(sizeof(int) * n);
+    int* stack = malloc(sizeof(int) * n);
+    if (n && (!first_child || !next_sibling || !stack)) DIE("Out of memory in type table");
+
+    for (int i = 0; i < n; i++)
+        first_child[i] = -1;
+    // De atras hacia adelante para que los hijos queden en el orden de la tabla
+    for (int i = n - 1; i >= 0; i--) {
+        TypeDescriptor* parent = table->types[i]->parent;
+        next_sibling[i] = parent ? first_child[parent->type_id] : -1;
+        if (parent) first_child[parent->type_id] = i;
+    }
+
+    unsigned epoch = table->hierarchy_epoch;
+    int counter = 0;
+    for (int root = 0; root < n; root++) {
+        if (table->types[root]->parent) continue;
+
+        // Cada hijo se visita al sacar a su padre o hermano anterior de la pila
+        int top = 0;
+        stack[top++] = root;
+        table->types[root]->hierarchy_first = counter++;
+        while (top > 0) {
+            int current = stack[top - 1];
+            int child = first_child[current];
+            if (child >= 0) {
+                first_child[current] = next_sibling[child];    // Ya no hace falta la lista
+                table->types[child]->hierarchy_first = counter++;
+                stack[top++] = child;
+            } else {
+                table->types[current]->hierarchy_last = counter - 1;
+                table->types[current]->hierarchy_epoch = epoch;
+                top--;
+            }
+        }
+    }
+    // Un tipo en un ciclo no se alcanza y sigue usando el recorrido por padres
+
+    free(first_child);
+    free(next_sibling);
+    free(stack);
+}
+
 void register_builtin_types(TypeTable* type_table) {
     TypeDescriptor* object_type = create_builtin_type(HULK_Type_Object, "Object", NULL);
 
+    BuiltinTypes* handles = &type_table->builtins;
+    handles->object = object_type;
+    handles->number = create_builtin_type(HULK_Type_Number, "Number", object_type);
+    handles->boolean = create_builtin_type(HULK_Type_Boolean, "Bool", object_type);
+    handles->string = create_builtin_type(HULK_Type_String, "String", object_type);
+    handles->null = create_builtin_type(HULK_Type_Null, "Null", object_type);
+    handles->undefined = create_builtin_type(HULK_Type_Undefined, "Undefined", object_type);
+    handles->error = create_builtin_type(HULK_Type_Error, "_Error", NULL);
+
     TypeDescriptor* builtins[] = {
-        object_type,
-        create_builtin_type(HULK_Type_Number, "Number", object_type),
-        create_builtin_type(HULK_Type_Boolean, "Bool", object_type),
-        create_builtin_type(HULK_Type_String, "String", object_type),
-        create_builtin_type(HULK_Type_Null, "Null", object_type),
-        create_builtin_type(HULK_Type_Undefined, "Undefined", object_type),
-        create_builtin_type(HULK_Type_Error, "_Error", NULL)
+        handles->object,
+        handles->number,
+        handles->boolean,
+        handles->string,
+        handles->null,
+        handles->undefined,
+        handles->error
     };
 
     int count = sizeof(builtins) / sizeof(builtins[0]);
@@ -104,18 +215,15 @@ TypeDescriptor* require_type(TypeTable* table, const char* name) {
     TypeDescriptor* td = type_table_lookup(table, name);
     if (!td) {
         fprintf(stderr, "Error: tipo '%s' no encontrado\n", name);
-        exit(1);
+        compilation_fatal(1);
     }
     return td;
 }
 
 TypeDescriptor* type_table_lookup(TypeTable *table, const char *name) {
-    for (int i = 0; i < table->count; i++) {
-        if (strcmp(table->types[i]->type_name, name) == 0) {
-            return table->types[i];
-        }
-    }
-    return NULL; // Tipo no encontrado
+    if (!name) return NULL;
+    int slot = index_slot(table, name);
+    return table->index[slot] ? table->types[table->index[slot] - 1] : NULL; // NULL si no se encuentra
 }
 
 void free_type_table(TypeTable *table) {
@@ -123,5 +231,6 @@ void free_type_table(TypeTable *table) {
         free_type_descriptor(table->types[i]);
     }
     free(table->types);
+    free(table->index);
     free(table);
 }
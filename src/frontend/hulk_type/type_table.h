@@ -3,17 +3,43 @@
 
 #include "hulk_type.h"
 
+typedef struct BuiltinTypes {
+    // Tipos builtin resueltos una vez en register_builtin_types, para no buscarlos por nombre
+    TypeDescriptor* object;
+    TypeDescriptor* number;
+    TypeDescriptor* boolean;
+    TypeDescriptor* string;
+    TypeDescriptor* null;
+    TypeDescriptor* undefined;
+    TypeDescriptor* error;
+} BuiltinTypes;
+
 typedef struct TypeTable {
-    TypeDescriptor **types;
+    TypeDescriptor **types;     // Indexado por type_id
     int count;
     int capacity;
+    int* index;                 // Hash del nombre internado -> type_id + 1 (0 = vacio)
+    int index_capacity;         // Potencia de 2, al menos el doble de count
+    BuiltinTypes builtins;      // Vacio hasta register_builtin_types
+    // Epoca de la numeracion del arbol de herencia (number_type_hierarchy). Sube
+    // cuando un tipo de la tabla cambia de padre; los tipos nuevos tienen la
+    // epoca 0, que nunca es valida.
+    unsigned hierarchy_epoch;
 } TypeTable;
 
 // Prototipos funciones
 TypeTable* create_type_table();
+// Tabla nueva con copias de los tipos de 'base', que solo puede tener tipos builtin
+// (la del prelude). Asi cada compilacion agrega sus tipos sin tocar la original.
+TypeTable* copy_type_table(const TypeTable* base);
 void add_type(TypeTable *table, TypeDescriptor *type);
 void add_user_defined_type(TypeTable* table, TypeDefinitionNode* type_def_node, SymbolTable* current_scope);
 void register_builtin_types(TypeTable* type_table);
+// Numera el arbol de herencia para que conforms/inherits_from sean O(1). Se llama
+// cuando ya estan registrados todos los tipos; si despues alguno cambia de padre
+// se vuelve al recorrido por la cadena de padres.
+void number_type_hierarchy(TypeTable* table);
+// 'name' debe estar internado (intern.h): se busca por puntero, sin volver a hashear el texto
 TypeDescriptor* require_type(TypeTable* table, const char* name);
 TypeDescriptor* type_table_lookup(TypeTable *table, const char *name);
 void free_type_table(TypeTable *table);
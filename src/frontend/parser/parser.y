@@ -5,18 +5,70 @@
 #include <ctype.h>
 #include "ast/ast.h"
 #include "common/common.h"
+#include "common/intern.h"
 #include "hulk_type/type_table.h"
+%}
 
-extern char* yytext;
+%code requires {
+#include "common/context.h"
+
+// Listas que el parser construye antes de crear el nodo (los constructores del
+// AST copian los elementos a la arena y la lista temporal se libera)
+typedef struct ParamList {
+    char** names;
+    char** types;
+    int count;
+    int capacity;
+} ParamList;
+}
 
-int yylex(void);
-int yyparse(void);
-void yyerror(const char *s);
+%code {
+// Scanner reentrante generado por flex (lexer.l)
+int yylex(YYSTYPE* yylval_param, void* yyscanner);
+char* yyget_text(void* yyscanner);
+void yyerror(void* scanner, CompilationContext* ctx, const char *s);
+
+// Agrega un elemento a una lista temporal duplicando la capacidad cuando se
+// llena, de modo que construir una lista de n elementos cuesta O(n)
+#define LIST_PUSH(items, count, capacity, item) do {                          \
+        if ((count) == (capacity)) {                                          \
+            (capacity) = (capacity) ? (capacity) * 2 : 4;                     \
+            (items) = realloc((items), (size_t)(capacity) * sizeof(*(items))); \
+            if (!(items)) DIE("Out of memory in parser list");                \
+        }                                                                     \
+        (items)[(count)++] = (item);                                          \
+    } while (0)
+
+static void param_list_push(ParamList* list, char* name, char* type) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 4;
+        list->names = realloc(list->names, (size_t)list->capacity * sizeof(char*));
+        list->types = realloc(list->types, (size_t)list->capacity * sizeof(char*));
+        if (!list->names || !list->types) DIE("Out of memory in ParameterList");
+    }
+    list->names[list->count] = name;
+    list->types[list->count] = type;
+    list->count++;
+}
 
-ASTNode *root_node;
-TypeTable *type_table;
+static void param_list_free(ParamList* list) {
+    free(list->names);
+    free(list->types);
+}
 
-%}
+// Invierte una lista temporal en el sitio
+static void reverse_list(void** items, int count) {
+    for (int i = 0, j = count - 1; i < j; i++, j--) {
+        void* tmp = items[i];
+        items[i] = items[j];
+        items[j] = tmp;
+    }
+}
+}
+
+%define api.pure full
+%parse-param { void* scanner } { CompilationContext* ctx }
+%lex-param { void* scanner }
 
 %define parse.error verbose
 
@@ -26,22 +78,24 @@ TypeTable *type_table;
     char* sval;
     HULK_Op token;
     struct ASTNode* node;
-    struct { struct ASTNode** nodes;  int count;} node_list;
+    struct { struct ASTNode** nodes;  int count; int capacity;} node_list;
     struct VariableAssigmentNode* var_assig_node;
-    struct { struct VariableAssigmentNode** list; int count; } var_assig_node_list;
+    struct { struct VariableAssigmentNode** list; int count; int capacity; } var_assig_node_list;
     struct { char* name; char* type;} param_info;
-    struct { char** names ; char** types; int count;} param_list_info;
-    struct { char* name; char** param_names; char** param_types; int param_count; char* return_type;} function_header;
-    struct { char* name; char** param_names; char** param_types; int param_count;  
+    ParamList param_list_info;
+    struct { char* name; ParamList params; char* return_type;} function_header;
+    struct { char* name; ParamList params;
              char* parent_name; struct ASTNode** parent_args; int parent_args_count;} type_def_header;
     struct { char* name; struct ASTNode** nodes; int count ;} inherit_info;
-    struct { TypeDefinitionNode** nodes; int count;} type_def_list;
-    
+    struct { FunctionDefinitionNode** nodes; int count; int capacity;} function_def_list;
+    struct { TypeDefinitionNode** nodes; int count; int capacity;} type_def_list;
+
 }
 
 %token <dval> NUMBER
 %token <ival> BOOLEAN
-%token <sval> STRING ID 
+%token <sval> STRING
+%token <sval> ID          // Internados por el lexer
 %token <token> COMP
 %token ADD SUB MUL DIV MOD POW
 %token CONCAT DCONCAT
@@ -51,8 +105,9 @@ TypeTable *type_table;
 %token ASSIGN REASSIGN FUNCTION ARROW TYPE INHERITS
 
 %type<node> Expression ExprBlock OrExpr AndExpr CompExpr AddExpr MultExpr PowExpr T WhileLoopExpr LetInExpr
-%type<node> IfExpr Else_Elif_Branch FunctionDefList FunctionDefinition FunctionBody TypeDefinition TypeDefinitionBody TypeDefExpr
+%type<node> IfExpr Else_Elif_Branch FunctionDefinition FunctionBody TypeDefinition TypeDefinitionBody TypeDefExpr
 %type<node_list> ExpressionList OptionalExpressionList ArgList OptionalArgList OptionalParentArgs TypeExprList 
+%type<function_def_list> FunctionDefList
 %type<type_def_list> TypeDefinitionList
 %type<var_assig_node> VariableAssigment
 %type<var_assig_node_list> VariableAssigmentList
@@ -63,6 +118,14 @@ TypeTable *type_table;
 %type<param_list_info> ParameterList OptionalTypeParams
 %type<type_def_header> TypeDefinitionHeader
 
+// Un error de sintaxis descarta las listas a medio construir de la pila: se liberan
+// sus arreglos temporales (los nodos viven en la arena y los nombres estan internados)
+%destructor { free($$.nodes); } <node_list> <function_def_list> <type_def_list> <inherit_info>
+%destructor { free($$.list); } <var_assig_node_list>
+%destructor { param_list_free(&$$); } <param_list_info>
+%destructor { param_list_free(&$$.params); } <function_header>
+%destructor { param_list_free(&$$.params); free($$.parent_args); } <type_def_header>
+
 %left OR
 %left AND
 %left COMP
@@ -77,69 +140,68 @@ TypeTable *type_table;
 %%
 Program                 : FunctionDefList TypeDefinitionList Expression OptionalEnd 
                         {
-                            root_node = create_program_node(
-                                $1, 
-                                create_type_definition_list_node($2.nodes, $2.count, type_table),
+                            // Las listas se recogen en orden de la fuente (recursion por la
+                            // izquierda, pila acotada) y se invierten para conservar el orden
+                            // que el resto del compilador recibia de la antigua regla
+                            // recursiva por la derecha: la ultima definicion primero.
+                            reverse_list((void**)$1.nodes, $1.count);
+                            reverse_list((void**)$2.nodes, $2.count);
+                            ctx->root_node = create_program_node(
+                                create_function_definition_list_node($1.nodes, $1.count, ctx), 
+                                create_type_definition_list_node($2.nodes, $2.count, ctx),
                                 $3, 
-                                type_table); 
+                                ctx); 
+                            free($1.nodes);
+                            free($2.nodes);
                         }
                         ;
 
-FunctionDefList         : FUNCTION FunctionDefinition FunctionDefList     
+FunctionDefList         : FunctionDefList FUNCTION FunctionDefinition
                         { 
-                          $$ = append_function_definition_to_list( (FunctionDefinitionListNode*)$3 , (FunctionDefinitionNode*)$2 ); 
+                            $$ = $1;
+                            LIST_PUSH($$.nodes, $$.count, $$.capacity, (FunctionDefinitionNode*)$3);
                         } 
-                        | /* vacío */   { $$ = create_function_definition_list_node(type_table) ; } 
+                        | /* vacío */   { $$.nodes = NULL; $$.count = 0; $$.capacity = 0; } 
                         ;
 
 FunctionDefinition      : FunctionHeader FunctionBody 
                         { $$ = create_function_definition_node(
                           $1.name,
-                          $1.param_names,
-                          $1.param_types,
-                          $1.param_count,
+                          $1.params.names,
+                          $1.params.types,
+                          $1.params.count,
                           $1.return_type,
                           $2,
-                          type_table);
+                          ctx);
+                          param_list_free(&$1.params);
                         }
                         ;
 
 FunctionHeader          :  ID LPAREN ParameterList RPAREN OptionalType 
                         {
                            $$.name = $1;
-                           $$.param_names = $3.names;
-                           $$.param_types = $3.types;
-                           $$.param_count = $3.count;
+                           $$.params = $3;
                            $$.return_type = $5;
                         }
                         ;
 
-OptionalType            : /* empty */                       {$$ = strdup("Undefined");}
+OptionalType            : /* empty */                       {$$ = interned_names()->undefined;}
                         | COLON ID                          {$$ = $2;}
                         ;
 
 ParameterList           : /* empty */ 
                         {
-                            $$.names = NULL;
-                            $$.types = NULL;
-                            $$.count = 0;
+                            $$ = (ParamList){ NULL, NULL, 0, 0 };
                         }
                         | Parameter
                         {
-                            $$.names = malloc(sizeof(char*));
-                            $$.types = malloc(sizeof(char*));
-                            $$.names[0] = $1.name;
-                            $$.types[0] = $1.type;
-                            $$.count = 1;
+                            $$ = (ParamList){ NULL, NULL, 0, 0 };
+                            param_list_push(&$$, $1.name, $1.type);
                         }
                         | ParameterList COMMA Parameter 
                         {
-                            int new_count = $1.count + 1;
-                            $$.names = realloc($1.names, new_count * sizeof(char*));
-                            $$.types = realloc($1.types, new_count * sizeof(char*));
-                            $$.names[new_count - 1] = $3.name;
-                            $$.types[new_count - 1] = $3.type;
-                            $$.count = new_count;
+                            $$ = $1;
+                            param_list_push(&$$, $3.name, $3.type);
                         }
                         ;
 
@@ -154,63 +216,56 @@ TypeDefinitionList      : /* empty */
                         {
                             $$.nodes = NULL;
                             $$.count = 0;
+                            $$.capacity = 0;
                         }
-                        | TypeDefinition TypeDefinitionList
+                        | TypeDefinitionList TypeDefinition
                         {
-                            int new_count = $2.count + 1;
-                            TypeDefinitionNode** nodes = realloc($2.nodes, new_count * sizeof(TypeDefinitionNode*));
-                            if (!nodes) DIE("Out of memory in TypeDefinitionList");
-
-                            nodes[new_count - 1] = (TypeDefinitionNode*)$1;
-                            $$.nodes = nodes;
-                            $$.count = new_count;
+                            $$ = $1;
+                            LIST_PUSH($$.nodes, $$.count, $$.capacity, (TypeDefinitionNode*)$2);
                         }
                         ;
 
 TypeDefinition          : TypeDefinitionHeader TypeDefinitionBody
                         {
-                            $$ = create_type_definition_node($1.name, $1.param_names, $1.param_types, $1.param_count, $1.parent_name, 
-                            $1.parent_args, $1.parent_args_count, $2, type_table);
+                            $$ = create_type_definition_node($1.name, $1.params.names, $1.params.types, $1.params.count, $1.parent_name, 
+                            $1.parent_args, $1.parent_args_count, $2, ctx);
+                            param_list_free(&$1.params);
+                            free($1.parent_args);
                         }
                         ;
 
 TypeDefinitionHeader    : TYPE ID OptionalTypeParams OptionalInherits 
                         {
                           $$.name = $2;
-                          $$.param_names = $3.names;
-                          $$.param_types = $3.types;
-                          $$.param_count = $3.count;
+                          $$.params = $3;
                           $$.parent_name = $4.name;
                           $$.parent_args = $4.nodes;
                           $$.parent_args_count = $4.count;
                         }
                         ;
 
-OptionalTypeParams      : /*empty*/                     {$$.names = NULL; $$.types = NULL; $$.count = 0; }
+OptionalTypeParams      : /*empty*/                     {$$ = (ParamList){ NULL, NULL, 0, 0 }; }
                         | LPAREN ParameterList RPAREN   {$$ = $2;}
                         ;
 
 OptionalInherits        : INHERITS ID OptionalParentArgs {$$.name = $2; $$.nodes = $3.nodes; $$.count = $3.count;}
-                        | /*empty*/                      {$$.name = "Object"; $$.nodes = NULL; $$.count = 0;}
+                        | /*empty*/                      {$$.name = interned_names()->object; $$.nodes = NULL; $$.count = 0;}
 
-OptionalParentArgs      : /*empty*/                      {$$.nodes = NULL; $$.count = 0;}
+OptionalParentArgs      : /*empty*/                      {$$.nodes = NULL; $$.count = 0; $$.capacity = 0;}
                         | LPAREN ArgList RPAREN          {$$ = $2;}
 
 
 TypeDefinitionBody      : LBRACKET TypeExprList RBRACKET
                         {
-                            $$ = create_expression_block_node($2.nodes, $2.count, type_table);
+                            $$ = create_expression_block_node($2.nodes, $2.count, ctx);
+                            free($2.nodes);
                         }
 
-TypeExprList            : /* empty */                    { $$.nodes = NULL; $$.count = 0; }
+TypeExprList            : /* empty */                    { $$.nodes = NULL; $$.count = 0; $$.capacity = 0; }
                         | TypeExprList TypeDefExpr 
                         {
-                            int new_count = $1.count + 1;
-                            ASTNode** nodes = realloc($1.nodes, new_count * sizeof(ASTNode*));
-                            if (!nodes) DIE("Out of memory in TypeExprList");
-                            nodes[new_count - 1] = $2;
-                            $$.nodes = nodes;
-                            $$.count = new_count;
+                            $$ = $1;
+                            LIST_PUSH($$.nodes, $$.count, $$.capacity, $2);
                         }
                         ;
 
@@ -226,7 +281,7 @@ Expression              : OrExpr  {$$ = $1;}
 
 IfExpr                  : IF LPAREN Expression RPAREN Expression  Else_Elif_Branch %prec IFX
                         {
-                            $$ = create_conditional_node($3, $5, $6, type_table);
+                            $$ = create_conditional_node($3, $5, $6, ctx);
                         }
                         ;
 
@@ -236,7 +291,7 @@ Else_Elif_Branch        : /* empty */
                         }
                         | ELIF LPAREN Expression RPAREN Expression Else_Elif_Branch
                         {
-                            $$ = create_conditional_node($3, $5, $6, type_table);
+                            $$ = create_conditional_node($3, $5, $6, ctx);
                         }
                         | ELSE Expression
                         {
@@ -246,149 +301,134 @@ Else_Elif_Branch        : /* empty */
                     
 WhileLoopExpr           : WHILE LPAREN Expression RPAREN Expression
                         {
-                            $$ = create_while_loop_node($3, $5, type_table);
+                            $$ = create_while_loop_node($3, $5, ctx);
                         }
                         ;
 
 LetInExpr               : LET VariableAssigmentList IN Expression
                         {
-                            $$ = create_let_in_node($2.list, $2.count, $4, type_table);
+                            $$ = create_let_in_node($2.list, $2.count, $4, ctx);
+                            free($2.list);
                         }
                         ;
 
 VariableAssigmentList   : VariableAssigment
                         {
-                            VariableAssigmentNode** list = malloc(sizeof(VariableAssigmentNode*));
-                            list[0] = $1; 
-                            $$.list = list;
-                            $$.count = 1;
+                            $$.list = NULL;
+                            $$.count = 0;
+                            $$.capacity = 0;
+                            LIST_PUSH($$.list, $$.count, $$.capacity, $1);
                         }
                         | VariableAssigmentList COMMA VariableAssigment
                         {
-                            int new_count = $1.count + 1;
-                            VariableAssigmentNode** list = realloc($1.list, new_count * sizeof(VariableAssigmentNode*));
-                            list[new_count - 1] = $3;
-                            $$.list = list;
-                            $$.count = new_count;
+                            $$ = $1;
+                            LIST_PUSH($$.list, $$.count, $$.capacity, $3);
                         }
                         ;
 
 VariableAssigment       : Parameter ASSIGN Expression    
                         { 
-                            VariableAssigment* var = create_variable_assigment($1.name, $1.type, $3);
-                            $$ = (VariableAssigmentNode*)create_variable_assigment_node(var, type_table);
+                            VariableAssigment* var = create_variable_assigment($1.name, $1.type, $3, ctx);
+                            $$ = (VariableAssigmentNode*)create_variable_assigment_node(var, ctx);
                         }
                         ;
 
-OrExpr                  : OrExpr OR AndExpr         { $$ = create_binary_operation_node(OR_TK, $1, $3, type_table); }
+OrExpr                  : OrExpr OR AndExpr         { $$ = create_binary_operation_node(OR_TK, $1, $3, ctx); }
                         | AndExpr                   { $$ = $1; }
                         ;
 
-AndExpr                 : AndExpr AND CompExpr      { $$ = create_binary_operation_node(AND_TK, $1, $3, type_table); }
+AndExpr                 : AndExpr AND CompExpr      { $$ = create_binary_operation_node(AND_TK, $1, $3, ctx); }
                         | CompExpr                  { $$ = $1; }
                         ;
 
-CompExpr                : CompExpr COMP AddExpr     { $$ = create_binary_operation_node($2, $1, $3, type_table); }
+CompExpr                : CompExpr COMP AddExpr     { $$ = create_binary_operation_node($2, $1, $3, ctx); }
                         | AddExpr                   { $$ = $1; }
                         ;
 
-AddExpr                 : AddExpr ADD MultExpr      { $$ = create_binary_operation_node(PLUS_TK, $1, $3, type_table ); }
-                        | AddExpr SUB MultExpr      { $$ = create_binary_operation_node(MINUS_TK, $1, $3, type_table); }
-                        | AddExpr CONCAT MultExpr   { $$ = create_binary_operation_node(CONCAT_TK, $1, $3, type_table); }
-                        | AddExpr DCONCAT MultExpr  { $$ = create_binary_operation_node(D_CONCAT_TK, $1, $3, type_table); }
+AddExpr                 : AddExpr ADD MultExpr      { $$ = create_binary_operation_node(PLUS_TK, $1, $3, ctx ); }
+                        | AddExpr SUB MultExpr      { $$ = create_binary_operation_node(MINUS_TK, $1, $3, ctx); }
+                        | AddExpr CONCAT MultExpr   { $$ = create_binary_operation_node(CONCAT_TK, $1, $3, ctx); }
+                        | AddExpr DCONCAT MultExpr  { $$ = create_binary_operation_node(D_CONCAT_TK, $1, $3, ctx); }
                         | MultExpr                  { $$ = $1; }
                         ;
 
-MultExpr                : MultExpr MUL PowExpr      { $$ = create_binary_operation_node(MULT_TK, $1, $3, type_table); }
-                        | MultExpr DIV PowExpr      { $$ = create_binary_operation_node(DIV_TK, $1, $3, type_table ); }
-                        | MultExpr MOD PowExpr      { $$ = create_binary_operation_node(MOD_TK, $1, $3, type_table); }
+MultExpr                : MultExpr MUL PowExpr      { $$ = create_binary_operation_node(MULT_TK, $1, $3, ctx); }
+                        | MultExpr DIV PowExpr      { $$ = create_binary_operation_node(DIV_TK, $1, $3, ctx ); }
+                        | MultExpr MOD PowExpr      { $$ = create_binary_operation_node(MOD_TK, $1, $3, ctx); }
                         | PowExpr                   { $$ = $1; }
                         ;
 
-PowExpr                 : T POW PowExpr             { $$ = create_binary_operation_node(EXP_TK, $1, $3, type_table); }
+PowExpr                 : T POW PowExpr             { $$ = create_binary_operation_node(EXP_TK, $1, $3, ctx); }
                         | T                         { $$ = $1; }
                         ;
 
-T                       : NUMBER                    { $$ = create_number_literal_node($1 , type_table); }
-                        | BOOLEAN                   { $$ = create_bool_literal_node($1, type_table); }
-                        | STRING                    { $$ = create_string_literal_node($1, type_table); }
+T                       : NUMBER                    { $$ = create_number_literal_node($1 , ctx); }
+                        | BOOLEAN                   { $$ = create_bool_literal_node($1, ctx); }
+                        | STRING                    { $$ = create_string_literal_node($1, ctx); }
                         | LPAREN Expression RPAREN  { $$ = $2; }
-                        | NOT T                     { $$ = create_unary_operation_node(NOT_TK, $2, type_table); }
-                        | SUB T                     { $$ = create_unary_operation_node(MINUS_TK, $2, type_table); }
+                        | NOT T                     { $$ = create_unary_operation_node(NOT_TK, $2, ctx); }
+                        | SUB T                     { $$ = create_unary_operation_node(MINUS_TK, $2, ctx); }
                         | ExprBlock                 { $$ = $1; }  
-                        | ID                        { $$ = create_variable_node($1, type_table); }
-                        | ID REASSIGN Expression    { $$ = create_reassign_node($1, $3, type_table);}
+                        | ID                        { $$ = create_variable_node($1, ctx); }
+                        | ID REASSIGN Expression    { $$ = create_reassign_node($1, $3, ctx);}
                         | ID LPAREN ArgList RPAREN
                         { 
-                            $$ = create_function_call_node($1, $3.nodes, $3.count, type_table);
+                            $$ = create_function_call_node($1, $3.nodes, $3.count, ctx);
+                            free($3.nodes);
                         }
                         | NEW ID LPAREN ArgList RPAREN
                         {
-                            $$ = create_new_node($2, $4.nodes, $4.count, type_table);
+                            $$ = create_new_node($2, $4.nodes, $4.count, ctx);
+                            free($4.nodes);
                         }
                         | T DOT ID LPAREN ArgList RPAREN
                         {
                             // Método: objeto.metodo(args)
-                            $$ = create_attribute_access_node($1, $3, $5.nodes, $5.count, true, type_table);
+                            $$ = create_attribute_access_node($1, $3, $5.nodes, $5.count, true, ctx);
+                            free($5.nodes);
                         }
                         | T DOT ID
                         {
                             // Atributo: objeto.atributo
-                            $$ = create_attribute_access_node($1, $3, NULL, 0, false, type_table);
+                            $$ = create_attribute_access_node($1, $3, NULL, 0, false, ctx);
                         }
                                                 ;
 
 ArgList                 : OptionalArgList Expression
                         {
-                            int new_count = $1.count + 1;
-                            ASTNode** all_nodes = realloc($1.nodes, new_count * sizeof(ASTNode*));
-                            if (!all_nodes) DIE("Out of memory in ArgumentList");
-                            all_nodes[new_count - 1] = $2;
-                            $$.nodes = all_nodes;
-                            $$.count = new_count;
+                            $$ = $1;
+                            LIST_PUSH($$.nodes, $$.count, $$.capacity, $2);
                         }
-                        |   /*empty*/               { $$.nodes = NULL; $$.count = 0; }
+                        |   /*empty*/               { $$.nodes = NULL; $$.count = 0; $$.capacity = 0; }
                         ;
 
-OptionalArgList         :  /*empty*/                { $$.nodes = NULL; $$.count = 0;}
+OptionalArgList         :  /*empty*/                { $$.nodes = NULL; $$.count = 0; $$.capacity = 0; }
                         |  OptionalArgList Expression COMMA
                         {
-                            int new_count = $1.count + 1;
-                            ASTNode** nodes = realloc($1.nodes, new_count * sizeof(ASTNode*));
-                            if (!nodes) DIE("Out of memory in ExpressionListOpt");
-                            nodes[new_count - 1] = $2;
-                            $$.nodes = nodes;
-                            $$.count = new_count;
+                            $$ = $1;
+                            LIST_PUSH($$.nodes, $$.count, $$.capacity, $2);
                         }
                         ;
 
 ExprBlock               : LBRACKET ExpressionList RBRACKET 
                         {
-                            $$ = create_expression_block_node($2.nodes, $2.count, type_table);
+                            $$ = create_expression_block_node($2.nodes, $2.count, ctx);
                             free($2.nodes);
                         }
 
 ExpressionList           : OptionalExpressionList Expression OptionalEnd
                         {
-                            int new_count = $1.count + 1;
-                            ASTNode** all_nodes = realloc($1.nodes, new_count * sizeof(ASTNode*));
-                            if (!all_nodes) DIE("Out of memory in ExpressionList");
-                            all_nodes[new_count - 1] = $2;
-                            $$.nodes = all_nodes;
-                            $$.count = new_count;
+                            $$ = $1;
+                            LIST_PUSH($$.nodes, $$.count, $$.capacity, $2);
                         }
-                        |   /*empty*/               { $$.nodes = NULL; $$.count = 0; }
+                        |   /*empty*/               { $$.nodes = NULL; $$.count = 0; $$.capacity = 0; }
                         ;
 
-OptionalExpressionList   : /* empty */               { $$.nodes = NULL; $$.count = 0; }
+OptionalExpressionList   : /* empty */               { $$.nodes = NULL; $$.count = 0; $$.capacity = 0; }
                         | OptionalExpressionList Expression SEMICOLON
                         {
-                            int new_count = $1.count + 1;
-                            ASTNode** nodes = realloc($1.nodes, new_count * sizeof(ASTNode*));
-                            if (!nodes) DIE("Out of memory in ExpressionListOpt");
-                            nodes[new_count - 1] = $2;
-                            $$.nodes = nodes;
-                            $$.count = new_count;
+                            $$ = $1;
+                            LIST_PUSH($$.nodes, $$.count, $$.capacity, $2);
                         }
                         ;
                         
@@ -397,12 +437,18 @@ OptionalEnd             : SEMICOLON
                         ;
 %%
 
-void yyerror(const char *s) {
+void yyerror(void* scanner, CompilationContext* ctx, const char *s) {
     fprintf(stderr, "%s\n", s);
-    fprintf(stderr, "  (at line %d):", line_num);
-    fprintf(stderr, "\"%s... ,\"", current_line);
+    fprintf(stderr, "  (at line %u):", ctx->loc.line);
+
+    // Linea fuente hasta el token donde fallo el parseo
+    const char* text = yyget_text(scanner);
+    size_t length = 0;
+    const char* line = source_file_line(&ctx->source, ctx->loc.line, &length);
+    size_t upto = line ? ctx->loc.column - 1 + (text ? strlen(text) : 0) : 0;
+    fprintf(stderr, "\"%.*s... ,\"", (int)(upto < length ? upto : length), line ? line : "");
 
-    if (yytext && *yytext != '\0') {
-        fprintf(stderr, " near '%s'\n", yytext);
+    if (text && *text != '\0') {
+        fprintf(stderr, " near '%s'\n", text);
     }
 }
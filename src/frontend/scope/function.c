@@ -18,7 +18,7 @@ void register_predefined_functions_one_param(SymbolTable* global_scope, TypeTabl
         char* type = "Number";
         Param** param = create_predefined_function_params(&name, &type, 1);
         FunctionDefinitionNode* func = create_predefined_function(one_params_aritmetic_function[i], param, 1, global_scope, "Number", type_table);
-        insert_function(one_params_aritmetic_function[i], func, global_scope, type_table_lookup(type_table, "Number"));
+        insert_function(func, global_scope, type_table->builtins.number);
     }
 
     count = 2;
@@ -28,7 +28,7 @@ void register_predefined_functions_one_param(SymbolTable* global_scope, TypeTabl
         char* type = "String";
         Param** param = create_predefined_function_params(&name, &type, 1);
         FunctionDefinitionNode* func = create_predefined_function(one_params_str_function[i], param, 1, global_scope, "Number", type_table);
-        insert_function(one_params_str_function[i], func, global_scope, type_table_lookup(type_table, "Number"));
+        insert_function(func, global_scope, type_table->builtins.number);
     }
 }
 
@@ -40,33 +40,33 @@ void register_predefined_functions_two_params(SymbolTable* global_scope, TypeTab
         char* params_types[] = {"Number", "Number"};
         Param** params = create_predefined_function_params(params_names, params_types, 2);
         FunctionDefinitionNode* func = create_predefined_function(two_params_aritmetic_function[i], params, 2, global_scope, "Number", type_table);
-        insert_function(two_params_aritmetic_function[i], func, global_scope, type_table_lookup(type_table, "Number"));
+        insert_function(func, global_scope, type_table->builtins.number);
     }
 }
 
 void register_special_functions(SymbolTable* global_scope, TypeTable* type_table) {
     FunctionDefinitionNode* func_rand = create_predefined_function("rand", NULL, 0, global_scope, "Number", type_table);
-    insert_function("rand", func_rand, global_scope, type_table_lookup(type_table, "Number"));
+    insert_function(func_rand, global_scope, type_table->builtins.number);
 
     char* name = "code";
     char* type = "Number";
     Param** param = create_predefined_function_params(&name, &type, 1);
     FunctionDefinitionNode* func_exit = create_predefined_function("exit", param, 1, global_scope, NULL, type_table);
-    insert_function("exit", func_exit, global_scope, type_table_lookup(type_table, "Null"));
+    insert_function(func_exit, global_scope, type_table->builtins.null);
 
     char* param_print_name = "item";
     char* param_print_type = "Object";
     Param** print_param = create_predefined_function_params(&param_print_name, &param_print_type, 1);
     FunctionDefinitionNode* func_print = create_predefined_function("print", print_param, 1, global_scope, NULL, type_table);
-    insert_function("print", func_print, global_scope, type_table_lookup(type_table, "Null"));
+    insert_function(func_print, global_scope, type_table->builtins.null);
 }
 
 Param** create_predefined_function_params(char** params_names, char** params_types, int count) {
     Param** result = malloc(sizeof(Param *) * count);
     for (int i = 0; i < count; i++) {
         result[i] = malloc(sizeof(Param));
-        result[i]->name = params_names[i];
-        result[i]->static_type = params_types[i];
+        result[i]->name = intern_string(params_names[i]);
+        result[i]->static_type = intern_string(params_types[i]);
     }
     return result;
 }
@@ -74,33 +74,55 @@ Param** create_predefined_function_params(char** params_names, char** params_typ
 FunctionDefinitionNode* create_predefined_function(char* function_name, Param** params, int param_count, SymbolTable* global_scope, char* return_type, TypeTable* type_table) {
     FunctionDefinitionNode* node = malloc(sizeof(FunctionDefinitionNode));
     node->base.type = AST_Node_Function_Definition;
-    node->base.accept = generic_ast_accept;
-    node->base.return_type = type_table_lookup(type_table, "Null");
+    node->base.id = AST_NO_LOC;
+    node->base.return_type = type_table->builtins.null;
 
     node->body = NULL;
-    node->name = function_name;
+    node->name = intern_string(function_name);
     node->params = params;
     node->param_count = param_count;
     node->scope = create_symbol_table(global_scope);
-    node->static_return_type = return_type;
+    node->static_return_type = intern_string(return_type);
 
     for (int i = 0; i < param_count; i++) {
-        Symbol* param_symbol = malloc(sizeof(Symbol));
-        param_symbol->name = params[i]->name;
-        param_symbol->kind = SYMBOL_PARAMETER;
-        param_symbol->type = type_table_lookup(type_table, params[i]->static_type);
-        param_symbol->value = NULL;
+        Symbol* param_symbol = create_symbol(params[i]->name, SYMBOL_PARAMETER, type_table_lookup(type_table, params[i]->static_type), NULL);
         insert_symbol(node->scope, param_symbol);
     }
 
     return node;
 }
 
-void insert_function(char* func_name, FunctionDefinitionNode* node, SymbolTable* global_scope, TypeDescriptor* return_type) {
-    Symbol* s = malloc(sizeof(Symbol));
-    s->name = func_name;
-    s->kind = SYMBOL_FUNCTION;
-    s->value = (ASTNode*)node;
-    s->type = return_type;
+void insert_function(FunctionDefinitionNode* node, SymbolTable* global_scope, TypeDescriptor* return_type) {
+    // create_predefined_function ya interno el nombre
+    Symbol* s = create_symbol(node->name, SYMBOL_FUNCTION, return_type, (ASTNode*)node);
     insert_symbol(global_scope, s);
 }
+
+SymbolTable* copy_predefined_functions(const SymbolTable* base, TypeTable* type_table) {
+    SymbolTable* global_scope = create_symbol_table(NULL);
+    for (int i = 0; i < base->size; i++) {
+        Symbol* symbol = base->symbols[i];
+        FunctionDefinitionNode* func = (FunctionDefinitionNode*)symbol->value;
+
+        Param** params = func->param_count > 0 ? malloc(sizeof(Param*) * func->param_count) : NULL;
+        for (int j = 0; j < func->param_count; j++) {
+            params[j] = malloc(sizeof(Param));
+            *params[j] = *func->params[j];
+        }
+        FunctionDefinitionNode* copy = create_predefined_function(func->name, params, func->param_count, global_scope, func->static_return_type, type_table);
+        insert_function(copy, global_scope, type_table->types[symbol->type->type_id]);
+    }
+    return global_scope;
+}
+
+void free_global_scope(SymbolTable* global_scope, int count) {
+    if (!global_scope) return;
+    for (int i = 0; i < count; i++) {
+        FunctionDefinitionNode* func = (FunctionDefinitionNode*)global_scope->symbols[i]->value;
+        for (int j = 0; j < func->param_count; j++)
+            free(func->params[j]);
+        free(func->params);
+        free(func);
+    }
+    free_symbol_table(global_scope);
+}
@@ -4,7 +4,6 @@
 #include <stdlib.h>
 #include "ast.h"
 #include "hulk_type/type_table.h"
-#include "../../backend/codegen/ast_accept.h"
 
 // Prototypes
 void register_predefined_functions(SymbolTable* global_scope, TypeTable* type_table);
@@ -13,5 +12,12 @@ void register_predefined_functions_two_params(SymbolTable* global_scope, TypeTab
 void register_special_functions(SymbolTable* global_scope, TypeTable* type_table);
 Param** create_predefined_function_params(char** params_names, char** params_types, int count);
 FunctionDefinitionNode* create_predefined_function(char* function_name, Param** params,int param_count, SymbolTable* global_scope, char* return_type, TypeTable* type_table);
-void insert_function(char* func_name, FunctionDefinitionNode* node, SymbolTable* global_scope, TypeDescriptor* return_type);
+void insert_function(FunctionDefinitionNode* node, SymbolTable* global_scope, TypeDescriptor* return_type);
+
+// Scope global nuevo con copias de las funciones predefinidas de 'base' (el del
+// prelude), tipadas con los tipos de type_table (una copia de la tabla del prelude)
+SymbolTable* copy_predefined_functions(const SymbolTable* base, TypeTable* type_table);
+// Libera las primeras 'count' funciones de global_scope, que deben ser predefinidas,
+// y despues el scope con sus simbolos y todos los scopes hijos (funciones, tipos y let)
+void free_global_scope(SymbolTable* global_scope, int count);
 #endif
\ No newline at end of file
@@ -5,14 +5,11 @@ Symbol* create_symbol(const char* name, SymbolKind kind, TypeDescriptor* type, A
     if (!symbol) {
         return NULL; // Error allocating memory
     }
-    symbol->name = strdup(name);
-    if (!symbol->name) {
-        free(symbol);
-        return NULL; // Error allocating memory
-    }
+    symbol->name = name;
     symbol->kind = kind;
     symbol->type = type;
     symbol->value = value; // Puede ser NULL si no hay un nodo AST asociado
+    symbol->slot = -1;
     return symbol;
 }
 
@@ -21,17 +18,74 @@ SymbolTable* create_symbol_table(SymbolTable* parent) {
     if (!table) {
         return NULL; // Error allocating memory
     }
-    table->capacity = 10; // Initial capacity
+    table->capacity = 4; // Initial capacity (la mayoria son scopes de let con uno o dos simbolos)
     table->size = 0;
     table->symbols = malloc(table->capacity * sizeof(Symbol*));
     if (!table->symbols) {
         free(table);
         return NULL; // Error allocating memory
     }
+    table->slots = NULL;
+    table->slot_capacity = 0;
     table->parent = parent;
+    table->first_child = NULL;
+    table->next_sibling = NULL;
+    table->symbol_counter = parent ? parent->symbol_counter : NULL;
+    if (parent) {
+        table->next_sibling = parent->first_child;
+        parent->first_child = table;
+    }
     return table;
 }
 
+// Hasta este tamaño un scope se recorre sin indice: es lo mas rapido para los
+// scopes chicos y no reserva memoria de mas
+#define SYMBOL_INDEX_THRESHOLD 8
+
+// Busca en un solo scope. Los simbolos con el mismo nombre comparten el slot de
+// inicio, asi que el sondeo los encuentra en orden de insercion, igual que el recorrido.
+static Symbol* find_in_scope(SymbolTable* table, const char* key, SymbolKind kind) {
+    if (!table->slots) {
+        for (int i = 0; i < table->size; i++) {
+            Symbol* sym = table->symbols[i];
+            if (sym->name == key && (kind == SYMBOL_ANY || sym->kind == kind))
+                return sym;
+        }
+        return NULL;
+    }
+
+    int mask = table->slot_capacity - 1;
+    for (int slot = (int)(interned_hash(key) & (uint32_t)mask); table->slots[slot]; slot = (slot + 1) & mask) {
+        Symbol* sym = table->symbols[table->slots[slot] - 1];
+        if (sym->name == key && (kind == SYMBOL_ANY || sym->kind == kind))
+            return sym;
+    }
+    return NULL;
+}
+
+static void index_symbol(SymbolTable* table, int index) {
+    int mask = table->slot_capacity - 1;
+    int slot = (int)(interned_hash(table->symbols[index]->name) & (uint32_t)mask);
+    while (table->slots[slot])
+        slot = (slot + 1) & mask;
+    table->slots[slot] = index + 1;
+}
+
+static void rebuild_index(SymbolTable* table) {
+    int capacity = table->slot_capacity ? table->slot_capacity : 2 * SYMBOL_INDEX_THRESHOLD;
+    while (capacity < table->size * 2)
+        capacity *= 2;
+
+    free(table->slots);
+    table->slots = calloc(capacity, sizeof(int));
+    if (!table->slots) {
+        DIE("Failed to resize symbol table");
+    }
+    table->slot_capacity = capacity;
+    for (int i = 0; i < table->size; i++)
+        index_symbol(table, i);
+}
+
 void insert_symbol(SymbolTable* table, Symbol* symbol) {
     
     // Check for valid input
@@ -44,7 +98,7 @@ void insert_symbol(SymbolTable* table, Symbol* symbol) {
     {
         // Lanzar error 
         fprintf(stderr, "Error[%d]: Redefinition of symbol \"%s\"\n", symbol->kind, symbol->name);
-        exit(1);        
+        compilation_fatal(1);        
     }
 
     // Resize the symbols array if necessary
@@ -59,6 +113,12 @@ void insert_symbol(SymbolTable* table, Symbol* symbol) {
     }
     // Insert the symbol into the table
     table->symbols[table->size++] = symbol;
+    if (table->slots && table->size * 2 <= table->slot_capacity)
+        index_symbol(table, table->size - 1);
+    else if (table->slots || table->size > SYMBOL_INDEX_THRESHOLD)
+        rebuild_index(table);
+    if (table->symbol_counter)
+        (*table->symbol_counter)++;
 }
 
 Symbol* lookup_symbol(SymbolTable* table, const char* name, SymbolKind kind, bool search_parent) {
@@ -66,15 +126,11 @@ Symbol* lookup_symbol(SymbolTable* table, const char* name, SymbolKind kind, boo
         return NULL; // Invalid input
     }
     
-    // Search for the symbol in the current table
-    for (int i = 0; i < table->size; i++) {
-        Symbol* sym = table->symbols[i];
-        if (strcmp(sym->name, name) == 0 && (kind == SYMBOL_ANY || sym->kind == kind)) 
-            return sym;        
-    }
-    // If not found in the current table, check the parent table if search_parent is true
-    if (table->parent && search_parent) {
-        return lookup_symbol(table->parent, name, kind, true);
+    // Los nombres de los simbolos y 'name' estan internados: basta comparar punteros
+    for (; table; table = search_parent ? table->parent : NULL) {
+        Symbol* sym = find_in_scope(table, name, kind);
+        if (sym)
+            return sym;
     }
     return NULL; // Symbol not found
 }
@@ -97,17 +153,21 @@ void set_symbol_return_type(SymbolTable* table, Symbol* symbol, TypeDescriptor*
 
 void free_symbol(Symbol* symbol) {
     if (symbol) {
-        free(symbol->name);
         free(symbol);
     }
 }
 
 void free_symbol_table(SymbolTable* table) {
     if (table) {
+        for (SymbolTable* child = table->first_child, *next; child; child = next) {
+            next = child->next_sibling;
+            free_symbol_table(child);
+        }
         for (int i = 0; i < table->size; i++) {
             free_symbol(table->symbols[i]);
         }
         free(table->symbols);
+        free(table->slots);
         free(table);
     }
 }
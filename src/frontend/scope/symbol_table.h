@@ -13,28 +13,41 @@ typedef struct Symbol {
     // - kind: tipo de simbolo (variable, funcion, parametro, builtin, etc.)
     // - type: tipo de dato del simbolo (TypeDescriptor)
     // - value: nodo AST asociado al simbolo (puede ser NULL si no hay)
-    char* name;
+    // - slot: indice de su valor en codegen, lo asigna resolve_bindings (-1 si no tiene).
+    //   Es dato de un solo programa: solo se asigna a simbolos de la copia del scope
+    //   global del CompilationContext y de los scopes que cuelgan de ella, nunca a los
+    //   del prelude compartido. end_compilation libera ese arbol de scopes entero
+    const char* name;           // Internado (intern.h)
     SymbolKind kind;
     TypeDescriptor* type;
     ASTNode* value;
+    int slot;
 } Symbol;
 typedef struct SymbolTable {
     // Tabla que contiene los simbolos de un scope.
-    Symbol** symbols;
+    Symbol** symbols;           // En orden de insercion
     int capacity;
     int size;
+    int* slots;                 // Hash del nombre -> indice en symbols + 1 (0 = vacio); NULL en scopes chicos
+    int slot_capacity;          // Potencia de 2, al menos el doble de size
     struct SymbolTable* parent; // para scopes anidados
+    struct SymbolTable* first_child;  // Scopes creados con este como padre; se liberan con el
+    struct SymbolTable* next_sibling;
+    int* symbol_counter;        // Contador de simbolos de la compilacion (heredado del padre, puede ser NULL)
 } SymbolTable;
 
 // Prototipos para simbolos
+// name debe estar internado (intern.h): el simbolo guarda el mismo puntero
 Symbol* create_symbol(const char *name, SymbolKind kind, TypeDescriptor* type, ASTNode* value);
 void free_symbol(Symbol *symbol);
 
 // Prototipos para tabla de simbolos
 SymbolTable* create_symbol_table(SymbolTable *parent);
+// Libera el scope, sus simbolos y todos los scopes creados debajo de el
 void free_symbol_table(SymbolTable *table);
 
 void insert_symbol(SymbolTable *table, Symbol *symbol);
+// 'name' debe estar internado (intern.h): se busca por puntero y con su hash ya calculado
 Symbol* lookup_symbol(SymbolTable *table, const char *name, SymbolKind kind, bool search_in_parent);
 Symbol* lookup_function_by_signature(SymbolTable* table, const char* name, int arg_count);
 void set_symbol_return_type(SymbolTable *table, Symbol* symbol, TypeDescriptor *return_type);
@@ -1,4 +1,5 @@
 #include "check_semantic.h"
+#include "semantic_visitor.h"
 #include "../hulk_type/type_table.h"
 #include "../common/common.h"
 
@@ -6,20 +7,20 @@ TypeDescriptor* check_semantic_literal_node(ASTNode* node) {
     return node->return_type;
 }
 
-TypeDescriptor* check_semantic_unary_operation_node(UnaryOperationNode* node, TypeTable* table) {
+TypeDescriptor* check_semantic_unary_operation_node(UnaryOperationNode* node, SemanticVisitor* visitor) {
     ASTNode* operand = node->operand;
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+    TypeDescriptor* error_type = visitor->builtins->error;
     switch (node->operator) {
         case NOT_TK:
             if (operand->return_type->tag != HULK_Type_Boolean) {
-                report_semantic_error((ASTNode*)node, "Invalid type for operator \"%s\": expected \"Bool\" but received \"%s\"", Hulk_Op_Names[node->operator], operand->return_type->type_name);
+                report_semantic_error(visitor, (ASTNode*)node, "Invalid type for operator \"%s\": expected \"Bool\" but received \"%s\"", Hulk_Op_Names[node->operator], operand->return_type->type_name);
                 node->base.return_type = error_type;
                 return error_type;
             }
             break;
         case MINUS_TK:
             if (operand->return_type->tag != HULK_Type_Number) {
-                report_semantic_error((ASTNode*)node, "Invalid type for operator \"%s\": expected \"Number\" but received \"%s\"", Hulk_Op_Names[node->operator], operand->return_type->type_name);
+                report_semantic_error(visitor, (ASTNode*)node, "Invalid type for operator \"%s\": expected \"Number\" but received \"%s\"", Hulk_Op_Names[node->operator], operand->return_type->type_name);
                 node->base.return_type = error_type;
                 return error_type;
             }
@@ -31,13 +32,13 @@ TypeDescriptor* check_semantic_unary_operation_node(UnaryOperationNode* node, Ty
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node, TypeTable* table) {
+TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node, SemanticVisitor* visitor) {
     ASTNode* left = node->left;
     ASTNode* right = node->right;
-    TypeDescriptor* number_type = type_table_lookup(table, "Number");
-    TypeDescriptor* bool_type = type_table_lookup(table, "Bool");
-    TypeDescriptor* string_type = type_table_lookup(table, "String");
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+    TypeDescriptor* number_type = visitor->builtins->number;
+    TypeDescriptor* bool_type = visitor->builtins->boolean;
+    TypeDescriptor* string_type = visitor->builtins->string;
+    TypeDescriptor* error_type = visitor->builtins->error;
 
     // Evita errores en cascada
     if (left->return_type == error_type || right->return_type == error_type) {
@@ -53,7 +54,7 @@ TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node,
         case MOD_TK:
         case EXP_TK:
             if (left->return_type->tag != HULK_Type_Number || right->return_type->tag != HULK_Type_Number) {
-                report_semantic_error((ASTNode*)node, "Invalid types for operator \"%s\": expected \"Number\" and \"Number\" but received \"%s\" and \"%s\"",
+                report_semantic_error(visitor, (ASTNode*)node, "Invalid types for operator \"%s\": expected \"Number\" and \"Number\" but received \"%s\" and \"%s\"",
                     Hulk_Op_Names[node->operator], left->return_type->type_name, right->return_type->type_name);
                 node->base.return_type = error_type;
                 return error_type;
@@ -68,7 +69,7 @@ TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node,
         case LT_TK:
         case LE_TK:
             if (left->return_type->tag != HULK_Type_Number || right->return_type->tag != HULK_Type_Number) {
-                report_semantic_error((ASTNode*)node, "Invalid types for operator \"%s\": expected \"Number\" and \"Number\" but received \"%s\" and \"%s\"",
+                report_semantic_error(visitor, (ASTNode*)node, "Invalid types for operator \"%s\": expected \"Number\" and \"Number\" but received \"%s\" and \"%s\"",
                     Hulk_Op_Names[node->operator], left->return_type->type_name, right->return_type->type_name);
                 node->base.return_type = error_type;
                 return error_type;
@@ -79,7 +80,7 @@ TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node,
         case AND_TK:
         case OR_TK:
             if (left->return_type->tag != HULK_Type_Boolean || right->return_type->tag != HULK_Type_Boolean) {
-                report_semantic_error((ASTNode*)node, "Invalid types for operator \"%s\": expected \"Bool\" and \"Bool\" but received \"%s\" and \"%s\"",
+                report_semantic_error(visitor, (ASTNode*)node, "Invalid types for operator \"%s\": expected \"Bool\" and \"Bool\" but received \"%s\" and \"%s\"",
                     Hulk_Op_Names[node->operator], left->return_type->type_name, right->return_type->type_name);
                 node->base.return_type = error_type;
                 return error_type;
@@ -90,7 +91,7 @@ TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node,
         case CONCAT_TK:
         case D_CONCAT_TK:
             if (left->return_type->tag != HULK_Type_String) {
-                report_semantic_error((ASTNode*)node, "Invalid types for operator \"%s\": expected \"String\" and \"Any\" but received \"%s\" and \"%s\"",
+                report_semantic_error(visitor, (ASTNode*)node, "Invalid types for operator \"%s\": expected \"String\" and \"Any\" but received \"%s\" and \"%s\"",
                     Hulk_Op_Names[node->operator], left->return_type->type_name, right->return_type->type_name);
                 node->base.return_type = error_type;
                 return error_type;
@@ -105,23 +106,23 @@ TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node,
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_expression_block_node(ExpressionBlockNode* node, TypeTable* table) {
+TypeDescriptor* check_semantic_expression_block_node(ExpressionBlockNode* node, SemanticVisitor* visitor) {
     if (node->expression_count == 0) 
-        node->base.return_type = type_table_lookup(table, "Null");
+        node->base.return_type = visitor->builtins->null;
     else 
         node->base.return_type = node->expressions[node->expression_count - 1]->return_type;
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_conditional_node(ConditionalNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_conditional_node(ConditionalNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     ASTNode* condition = node->condition;
     if (condition->return_type == error_type) {
         node->base.return_type = error_type;
         return error_type;
     }
     if (condition->return_type->tag != HULK_Type_Boolean) {
-        report_semantic_error((ASTNode*)node, "Invalid type for condition on if statement, expected \"Bool\" but received \"%s\"", condition->return_type->type_name);
+        report_semantic_error(visitor, (ASTNode*)node, "Invalid type for condition on if statement, expected \"Bool\" but received \"%s\"", condition->return_type->type_name);
         node->base.return_type = error_type;
         return error_type;
     }
@@ -137,7 +138,7 @@ TypeDescriptor* check_semantic_conditional_node(ConditionalNode* node, TypeTable
     if (!else_branch || conforms(then_branch->return_type, else_branch->return_type))
         node->base.return_type = then_branch->return_type;
     else {
-        report_semantic_error((ASTNode*)node, "Then and Else branches of if-else statement must match, but received \"%s\" and \"%s\"",
+        report_semantic_error(visitor, (ASTNode*)node, "Then and Else branches of if-else statement must match, but received \"%s\" and \"%s\"",
             then_branch->return_type->type_name, else_branch->return_type->type_name);
         node->base.return_type = error_type;
     }
@@ -145,15 +146,15 @@ TypeDescriptor* check_semantic_conditional_node(ConditionalNode* node, TypeTable
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_while_loop_node(WhileLoopNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_while_loop_node(WhileLoopNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     ASTNode* condition = node->condition;
     if (condition->return_type == error_type) {
         node->base.return_type = error_type;
         return error_type;
     }
     if (condition->return_type->tag != HULK_Type_Boolean) {
-        report_semantic_error((ASTNode*)node, "Invalid type for condition on while loop statement, expected \"Bool\" but received \"%s\"", condition->return_type->type_name);
+        report_semantic_error(visitor, (ASTNode*)node, "Invalid type for condition on while loop statement, expected \"Bool\" but received \"%s\"", condition->return_type->type_name);
         node->base.return_type = error_type;
         return error_type;
     }
@@ -161,18 +162,18 @@ TypeDescriptor* check_semantic_while_loop_node(WhileLoopNode* node, TypeTable* t
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_let_in_node(LetInNode* node, TypeTable* table) {
+TypeDescriptor* check_semantic_let_in_node(LetInNode* node) {
     node->base.return_type = node->body->return_type;
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_variable_assigment_node(VariableAssigmentNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_variable_assigment_node(VariableAssigmentNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     VariableAssigment* assign = node->assigment;
-    TypeDescriptor* static_type = require_type(table, assign->static_type);
+    TypeDescriptor* static_type = require_type(visitor->typeTable, assign->static_type);
 
     if (!assign->value || !assign->value->return_type || assign->value->return_type == error_type) {
-        report_semantic_error((ASTNode*)node, "Invalid return value on assignment to variable '%s'", assign->name);
+        report_semantic_error(visitor, (ASTNode*)node, "Invalid return value on assignment to variable '%s'", assign->name);
         node->base.return_type = error_type;
         return error_type;
     }
@@ -180,7 +181,7 @@ TypeDescriptor* check_semantic_variable_assigment_node(VariableAssigmentNode* no
     TypeDescriptor* dynamic_type = assign->value->return_type;
 
     if (static_type->tag != HULK_Type_Undefined && !conforms(dynamic_type, static_type)) {
-        report_semantic_error((ASTNode*)node, "Type '%s' of value is not compatible with declared type '%s' in variable '%s'",
+        report_semantic_error(visitor, (ASTNode*)node, "Type '%s' of value is not compatible with declared type '%s' in variable '%s'",
             dynamic_type->type_name, static_type->type_name, assign->name);
         node->base.return_type = error_type;
         return error_type;
@@ -190,11 +191,11 @@ TypeDescriptor* check_semantic_variable_assigment_node(VariableAssigmentNode* no
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_variable_node(VariableNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_variable_node(VariableNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     Symbol* symbol = lookup_symbol(node->scope, node->name, SYMBOL_ANY, true);
     if (!symbol) {
-        report_semantic_error((ASTNode*)node, "Use of undeclared variable '%s'", node->name);
+        report_semantic_error(visitor, (ASTNode*)node, "Use of undeclared variable '%s'", node->name);
         node->base.return_type = error_type;
         return error_type;
     }
@@ -202,21 +203,21 @@ TypeDescriptor* check_semantic_variable_node(VariableNode* node, TypeTable* tabl
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_reassign_node(ReassignNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_reassign_node(ReassignNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     Symbol* symbol = lookup_symbol(node->scope, node->name, SYMBOL_ANY, true);
     if (!symbol) {
-        report_semantic_error((ASTNode*)node, "Reassignment to undeclared variable '%s'", node->name);
+        report_semantic_error(visitor, (ASTNode*)node, "Reassignment to undeclared variable '%s'", node->name);
         node->base.return_type = error_type;
         return error_type;
     }
     if (symbol->kind == SYMBOL_FUNCTION || symbol->kind == SYMBOL_TYPE_METHOD) {
-        report_semantic_error((ASTNode*)node, "Invalid reassignment: '%s' is not a variable", node->name);
+        report_semantic_error(visitor, (ASTNode*)node, "Invalid reassignment: '%s' is not a variable", node->name);
         node->base.return_type = error_type;
         return error_type;
     }
     if (!conforms(node->value->return_type, symbol->type)) {
-        report_semantic_error((ASTNode*)node, "Type mismatch in reassignment to variable '%s': expected '%s', got '%s'",
+        report_semantic_error(visitor, (ASTNode*)node, "Type mismatch in reassignment to variable '%s': expected '%s', got '%s'",
             node->name, symbol->type->type_name, node->value->return_type->type_name);
         node->base.return_type = error_type;
         return error_type;
@@ -225,32 +226,32 @@ TypeDescriptor* check_semantic_reassign_node(ReassignNode* node, TypeTable* tabl
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_function_definition_node(FunctionDefinitionNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_function_definition_node(FunctionDefinitionNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     TypeDescriptor* body_return_type = node->body->return_type;
-    TypeDescriptor* static_return_type = type_table_lookup(table, node->static_return_type);
+    TypeDescriptor* static_return_type = type_table_lookup(visitor->typeTable, node->static_return_type);
 
     if (!static_return_type) {
-        report_semantic_error((ASTNode*)node, "Undefined type \"%s\" for function return type", node->static_return_type);
+        report_semantic_error(visitor, (ASTNode*)node, "Undefined type \"%s\" for function return type", node->static_return_type);
         return error_type;
     }
     if (!body_return_type || body_return_type == error_type) {
-        report_semantic_error((ASTNode*)node, "Undefined return type in function body");
+        report_semantic_error(visitor, (ASTNode*)node, "Undefined return type in function body");
         return error_type;
     }
     if (static_return_type->tag == HULK_Type_Undefined || !conforms(body_return_type, static_return_type)) {
-        report_semantic_error((ASTNode*)node, "Function %s static return type is %s, but it returns %s",
+        report_semantic_error(visitor, (ASTNode*)node, "Function %s static return type is %s, but it returns %s",
             node->name, node->static_return_type, body_return_type->type_name);
         return error_type;
     }
     return body_return_type;
 }
 
-TypeDescriptor* check_semantic_function_call_node(FunctionCallNode* node, SymbolTable* current_scope, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_function_call_node(FunctionCallNode* node, SymbolTable* current_scope, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     Symbol* func_symbol = lookup_function_by_signature(current_scope, node->name, node->arg_count);
     if (!func_symbol) {
-        report_semantic_error((ASTNode*)node, "Undefined function '%s' with %d arguments", node->name, node->arg_count);
+        report_semantic_error(visitor, (ASTNode*)node, "Undefined function '%s' with %d arguments", node->name, node->arg_count);
         node->base.return_type = error_type;
         return error_type;
     }
@@ -259,7 +260,7 @@ TypeDescriptor* check_semantic_function_call_node(FunctionCallNode* node, Symbol
         TypeDescriptor* arg_type = node->args[i]->return_type;
         TypeDescriptor* expected_type = lookup_symbol(func_def->scope, func_def->params[i]->name, SYMBOL_PARAMETER, false)->type;
         if (!conforms(arg_type, expected_type)) {
-            report_semantic_error((ASTNode*)node, "Type error in argument %d of function '%s': expected '%s', got '%s'",
+            report_semantic_error(visitor, (ASTNode*)node, "Type error in argument %d of function '%s': expected '%s', got '%s'",
                 i, node->name, expected_type->type_name, arg_type->type_name);
             node->base.return_type = error_type;
             return error_type;
@@ -269,21 +270,21 @@ TypeDescriptor* check_semantic_function_call_node(FunctionCallNode* node, Symbol
     return node->base.return_type;
 }
 
-TypeDescriptor* check_semantic_type_definition_node(TypeDefinitionNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
-    TypeDescriptor* parent_node = type_table_lookup(table, node->parent_name);
+TypeDescriptor* check_semantic_type_definition_node(TypeDefinitionNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
+    TypeDescriptor* parent_node = type_table_lookup(visitor->typeTable, node->parent_name);
     if (!parent_node) {
-        report_semantic_error((ASTNode*)node, "Undefined type \"%s\"", node->parent_name);
+        report_semantic_error(visitor, (ASTNode*)node, "Undefined type \"%s\"", node->parent_name);
         return error_type;
     }
-    if (cmp_type(parent_node, type_table_lookup(table, "Object"))) {
+    if (cmp_type(parent_node, visitor->builtins->object)) {
         if (node->parent_arg_count != 0) {
-            report_semantic_error((ASTNode*)node, "Type 'Object' does not accept parameters in its constructor, but %d were provided.", node->parent_arg_count);
+            report_semantic_error(visitor, (ASTNode*)node, "Type 'Object' does not accept parameters in its constructor, but %d were provided.", node->parent_arg_count);
             return error_type;
         }
     } else {
         if (node->parent_arg_count != parent_node->info->param_count) {
-            report_semantic_error((ASTNode*)node, "Invalid type init, type \"%s\" constructor expects %d parameters but received %d",
+            report_semantic_error(visitor, (ASTNode*)node, "Invalid type init, type \"%s\" constructor expects %d parameters but received %d",
                 node->parent_name, parent_node->info->param_count, node->parent_arg_count);
             return error_type;
         }
@@ -292,51 +293,51 @@ TypeDescriptor* check_semantic_type_definition_node(TypeDefinitionNode* node, Ty
             char* param_name = parent_node->info->type_def->params[i]->name;
             TypeDescriptor* expected_type = lookup_symbol(parent_node->info->scope, param_name, SYMBOL_PARAMETER, false)->type;
             if (!conforms(arg_type, expected_type)) {
-                report_semantic_error((ASTNode*)node, "Type error, \"%s\" type was expecting \"%s\" type for \"%s\", but received \"%s\"",
+                report_semantic_error(visitor, (ASTNode*)node, "Type error, \"%s\" type was expecting \"%s\" type for \"%s\", but received \"%s\"",
                     node->parent_name, expected_type->type_name, param_name, arg_type->type_name);
                 return error_type;
             }
         }
     }
-    return type_table_lookup(table, "Null");
+    return visitor->builtins->null;
 }
 
-TypeDescriptor* check_semantic_new_node(NewNode* node, TypeTable* type_table) {
-    TypeDescriptor* error_type = type_table_lookup(type_table, "_Error");
-    TypeDescriptor* type_desc = type_table_lookup(type_table, node->type_name);
+TypeDescriptor* check_semantic_new_node(NewNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
+    TypeDescriptor* type_desc = type_table_lookup(visitor->typeTable, node->type_name);
     if (!type_desc) {
-        report_semantic_error((ASTNode*)node, "Type '%s' not found.", node->type_name);
+        report_semantic_error(visitor, (ASTNode*)node, "Type '%s' not found.", node->type_name);
         return error_type;
     }
     if (!type_desc->info) {
-        report_semantic_error((ASTNode*)node, "Type '%s' is not instantiable (no type_info defined).", node->type_name);
+        report_semantic_error(visitor, (ASTNode*)node, "Type '%s' is not instantiable (no type_info defined).", node->type_name);
         return error_type;
     }
     int param_count = type_desc->info->param_count;
     char** params_name = type_desc->info->params_name;
     if (node->arg_count != param_count) {
-        report_semantic_error((ASTNode*)node, "Type '%s' expects %d arguments for the constructor, but %d were provided.",
+        report_semantic_error(visitor, (ASTNode*)node, "Type '%s' expects %d arguments for the constructor, but %d were provided.",
             node->type_name, param_count, node->arg_count);
         return error_type;
     }
     for (int i = 0; i < node->arg_count; i++) {
         TypeDescriptor* arg_type = node->args[i]->return_type;
         if (!arg_type || arg_type == error_type) {
-            report_semantic_error((ASTNode*)node, "Could not determine the type of argument %d.", i);
+            report_semantic_error(visitor, (ASTNode*)node, "Could not determine the type of argument %d.", i);
             return error_type;
         }
         Symbol* param_symbol = lookup_symbol(type_desc->info->scope, params_name[i], SYMBOL_PARAMETER, false);
         if (!param_symbol) {
-            report_semantic_error((ASTNode*)node, "Internal error: Parameter '%s' not found in type '%s'.", params_name[i], node->type_name);
+            report_semantic_error(visitor, (ASTNode*)node, "Internal error: Parameter '%s' not found in type '%s'.", params_name[i], node->type_name);
             return error_type;
         }
         TypeDescriptor* expected_type = param_symbol->type;
         if (!expected_type) {
-            report_semantic_error((ASTNode*)node, "Internal error: Parameter '%s' has no defined type.", params_name[i]);
+            report_semantic_error(visitor, (ASTNode*)node, "Internal error: Parameter '%s' has no defined type.", params_name[i]);
             return error_type;
         }
         if (!conforms(arg_type, expected_type)) {
-            report_semantic_error((ASTNode*)node, "Argument %d ('%s') has incompatible type (expected '%s', got '%s').",
+            report_semantic_error(visitor, (ASTNode*)node, "Argument %d ('%s') has incompatible type (expected '%s', got '%s').",
                 i, params_name[i], expected_type->type_name, arg_type->type_name);
             return error_type;
         }
@@ -345,27 +346,27 @@ TypeDescriptor* check_semantic_new_node(NewNode* node, TypeTable* type_table) {
     return type_desc;
 }
 
-TypeDescriptor* check_semantic_attribute_access_node(AttributeAccessNode* node, TypeTable* table) {
-    TypeDescriptor* error_type = type_table_lookup(table, "_Error");
+TypeDescriptor* check_semantic_attribute_access_node(AttributeAccessNode* node, SemanticVisitor* visitor) {
+    TypeDescriptor* error_type = visitor->builtins->error;
     if (!node || !node->object) {
-        report_semantic_error((ASTNode*)node, "Internal Error: Null AttributeAccessNode or object.");
+        report_semantic_error(visitor, (ASTNode*)node, "Internal Error: Null AttributeAccessNode or object.");
         return error_type;
     }
     TypeDescriptor* obj_type = node->object->return_type;
     if (!obj_type || obj_type->tag != HULK_Type_UserDefined || !obj_type->info) {
-        report_semantic_error((ASTNode*)node, "Cannot access '%s' on non-instantiable type.", node->attribute_name);
+        report_semantic_error(visitor, (ASTNode*)node, "Cannot access '%s' on non-instantiable type.", node->attribute_name);
         return error_type;
     }
     SymbolTable* type_scope = obj_type->info->scope;
     if (!node->is_method_call) {
         Symbol* attr_symbol = lookup_symbol(type_scope, node->attribute_name, SYMBOL_TYPE_FIELD, false);
         if (!attr_symbol) {
-            report_semantic_error((ASTNode*)node, "'%s' is not defined as an attribute in type '%s'.", node->attribute_name, obj_type->type_name);
+            report_semantic_error(visitor, (ASTNode*)node, "'%s' is not defined as an attribute in type '%s'.", node->attribute_name, obj_type->type_name);
             return error_type;
         }
-        bool is_self = node->object->type == AST_Node_Variable && strcmp(((VariableNode*)node->object)->name, "self") == 0;
+        bool is_self = node->object->type == AST_Node_Variable && ((VariableNode*)node->object)->name == interned_names()->self;
         if (!is_self) {
-            report_semantic_error((ASTNode*)node, "Field '%s' of type '%s' is private and can only be accessed from within the type.", node->attribute_name, obj_type->type_name);
+            report_semantic_error(visitor, (ASTNode*)node, "Field '%s' of type '%s' is private and can only be accessed from within the type.", node->attribute_name, obj_type->type_name);
             return error_type;
         }
         node->base.return_type = attr_symbol->type;
@@ -380,23 +381,23 @@ TypeDescriptor* check_semantic_attribute_access_node(AttributeAccessNode* node,
             current = current->parent;
         }
         if (!method_symbol || !method_symbol->value) {
-            report_semantic_error((ASTNode*)node, "Method '%s' not found in type '%s'.", node->attribute_name, obj_type->type_name);
+            report_semantic_error(visitor, (ASTNode*)node, "Method '%s' not found in type '%s'.", node->attribute_name, obj_type->type_name);
             return error_type;
         }
         FunctionDefinitionNode* method = (FunctionDefinitionNode*)method_symbol->value;
         if (method->param_count != node->arg_count) {
-            report_semantic_error((ASTNode*)node, "Method '%s' expects %d arguments but got %d.", node->attribute_name, method->param_count, node->arg_count);
+            report_semantic_error(visitor, (ASTNode*)node, "Method '%s' expects %d arguments but got %d.", node->attribute_name, method->param_count, node->arg_count);
             return error_type;
         }
         for (int i = 0; i < node->arg_count; i++) {
             TypeDescriptor* expected = lookup_symbol(method->scope, method->params[i]->name, SYMBOL_PARAMETER, false)->type;
             TypeDescriptor* actual = node->args[i]->return_type;
             if (!expected || !actual || actual == error_type) {
-                report_semantic_error((ASTNode*)node, "Argument %d for method '%s' has undefined type.", i + 1, node->attribute_name);
+                report_semantic_error(visitor, (ASTNode*)node, "Argument %d for method '%s' has undefined type.", i + 1, node->attribute_name);
                 return error_type;
             }
             if (!conforms(actual, expected)) {
-                report_semantic_error((ASTNode*)node, "Argument %d for method '%s' expects type '%s' but got '%s'.",
+                report_semantic_error(visitor, (ASTNode*)node, "Argument %d for method '%s' expects type '%s' but got '%s'.",
                     i + 1, node->attribute_name, expected->type_name, actual->type_name);
                 return error_type;
             }
@@ -2,18 +2,20 @@
 #include "../ast/ast.h"
 #include "../scope/symbol_table.h"
 
+typedef struct SemanticVisitor SemanticVisitor;
+
 TypeDescriptor* check_semantic_literal_node(ASTNode* node);
-TypeDescriptor* check_semantic_unary_operation_node(UnaryOperationNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_expression_block_node(ExpressionBlockNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_conditional_node(ConditionalNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_while_loop_node(WhileLoopNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_let_in_node(LetInNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_variable_node(VariableNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_variable_assigment_node(VariableAssigmentNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_reassign_node(ReassignNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_function_definition_node(FunctionDefinitionNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_function_call_node(FunctionCallNode* node, SymbolTable* current_scope, TypeTable* table);
-TypeDescriptor* check_semantic_type_definition_node(TypeDefinitionNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_new_node(NewNode* node, TypeTable* table);
-TypeDescriptor* check_semantic_attribute_access_node(AttributeAccessNode* node, TypeTable* table);
+TypeDescriptor* check_semantic_unary_operation_node(UnaryOperationNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_binary_operation_node(BinaryOperationNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_expression_block_node(ExpressionBlockNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_conditional_node(ConditionalNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_while_loop_node(WhileLoopNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_let_in_node(LetInNode* node);
+TypeDescriptor* check_semantic_variable_node(VariableNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_variable_assigment_node(VariableAssigmentNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_reassign_node(ReassignNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_function_definition_node(FunctionDefinitionNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_function_call_node(FunctionCallNode* node, SymbolTable* current_scope, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_type_definition_node(TypeDefinitionNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_new_node(NewNode* node, SemanticVisitor* visitor);
+TypeDescriptor* check_semantic_attribute_access_node(AttributeAccessNode* node, SemanticVisitor* visitor);
@@ -18,14 +18,14 @@ void register_types(TypeDefinitionListNode* list, SymbolTable* current_scope, Ty
         
         if (!descriptor->info || !descriptor->info->scope) {
             fprintf(stderr, "Error interno: El tipo '%s' no tiene información válida (posible error en add_user_defined_type)\n", type_def_node->type_name);
-            exit(1);
+            compilation_fatal(1);
         }
 
         TypeDescriptor* parent_type = require_type(type_table, type_def_node->parent_name);
         if(!parent_type->initializated)
         {
             fprintf(stderr, "Error: Undeclared type '%s' \n", type_def_node->parent_name);
-            exit(1);
+            compilation_fatal(1);
         }
 
         type_def_node->scope = descriptor->info->scope;
@@ -42,9 +42,9 @@ void register_params(TypeDefinitionNode* type_def_node, SymbolTable* type_scope,
     for (int i = 0; i < type_def_node->param_count; i++) {
         Param* param = type_def_node->params[i];
 
-        if (strcmp(param->name, "self") == 0) {
+        if (param->name == interned_names()->self) {
             fprintf(stderr, "Error: 'self' is not a valid parameter name because it causes ambiguity on '%s' type \n", type_def_node->type_name);
-            exit(1);
+            compilation_fatal(1);
         }
 
         TypeDescriptor* param_type = require_type(type_table, param->static_type);
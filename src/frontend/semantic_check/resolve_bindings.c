@@ -0,0 +1,159 @@
+#include "resolve_bindings.h"
+
+static void declare(ProgramNode* program, Symbol* symbol) {
+    if (symbol && symbol->slot < 0)
+        symbol->slot = program->slot_count++;
+}
+
+// Igual que lookup_symbol(scope, name, SYMBOL_ANY, true), salvo que salta las
+// variables de let que todavia no se declararon (no tienen slot)
+static Symbol* resolve_name(SymbolTable* scope, const char* name) {
+    for (; scope; scope = scope->parent) {
+        Symbol* symbol = lookup_symbol(scope, name, SYMBOL_ANY, false);
+        if (symbol && !(symbol->kind == SYMBOL_VARIABLE && symbol->slot < 0))
+            return symbol;
+    }
+    return NULL;
+}
+
+static void resolve_node(ProgramNode* program, ASTNode* node);
+
+static void resolve_nodes(ProgramNode* program, ASTNode** nodes, int count) {
+    for (int i = 0; i < count; i++)
+        resolve_node(program, nodes[i]);
+}
+
+static void resolve_function(ProgramNode* program, FunctionDefinitionNode* function) {
+    for (int i = 0; i < function->param_count; i++)
+        declare(program, lookup_symbol(function->scope, function->params[i]->name, SYMBOL_PARAMETER, false));
+    resolve_node(program, function->body);
+}
+
+static void resolve_node(ProgramNode* program, ASTNode* node) {
+    if (!node) return;
+
+    switch (node->type) {
+    case AST_Node_Literal:
+        break;
+
+    case AST_Node_Unary_Operation:
+        resolve_node(program, ((UnaryOperationNode*)node)->operand);
+        break;
+
+    case AST_Node_Binary_Operation: {
+        BinaryOperationNode* binary = (BinaryOperationNode*)node;
+        resolve_node(program, binary->left);
+        resolve_node(program, binary->right);
+        break;
+    }
+
+    case AST_Node_Expression_Block: {
+        ExpressionBlockNode* block = (ExpressionBlockNode*)node;
+        resolve_nodes(program, block->expressions, block->expression_count);
+        break;
+    }
+
+    case AST_Node_Conditional: {
+        ConditionalNode* conditional = (ConditionalNode*)node;
+        resolve_node(program, conditional->condition);
+        resolve_node(program, conditional->then_branch);
+        resolve_node(program, conditional->else_branch);
+        break;
+    }
+
+    case AST_Node_While_Loop: {
+        WhileLoopNode* loop = (WhileLoopNode*)node;
+        resolve_node(program, loop->condition);
+        resolve_node(program, loop->body);
+        break;
+    }
+
+    case AST_Node_Let_In: {
+        // El scope del let tiene un simbolo por asignacion, en el mismo orden
+        LetInNode* let_in = (LetInNode*)node;
+        for (int i = 0; i < let_in->assigment_count; i++) {
+            resolve_node(program, (ASTNode*)let_in->assigments[i]);
+            declare(program, let_in->scope->symbols[i]);
+        }
+        resolve_node(program, let_in->body);
+        break;
+    }
+
+    case AST_Node_Variable_Assigment:
+        resolve_node(program, ((VariableAssigmentNode*)node)->assigment->value);
+        break;
+
+    case AST_Node_Variable: {
+        VariableNode* variable = (VariableNode*)node;
+        variable->binding = resolve_name(variable->scope, variable->name);
+        break;
+    }
+
+    case AST_Node_Reassign: {
+        ReassignNode* reassign = (ReassignNode*)node;
+        reassign->binding = resolve_name(reassign->scope, reassign->name);
+        resolve_node(program, reassign->value);
+        break;
+    }
+
+    case AST_Node_Function_Definition:
+        resolve_function(program, (FunctionDefinitionNode*)node);
+        break;
+
+    case AST_Node_Function_Definition_List: {
+        FunctionDefinitionListNode* list = (FunctionDefinitionListNode*)node;
+        for (int i = 0; i < list->function_count; i++) {
+            FunctionDefinitionNode* function = list->functions[i];
+            declare(program, lookup_symbol(function->scope, function->name, SYMBOL_FUNCTION, true));
+            resolve_function(program, function);
+        }
+        break;
+    }
+
+    case AST_Node_Function_Call: {
+        FunctionCallNode* call = (FunctionCallNode*)node;
+        call->binding = lookup_function_by_signature(call->scope, call->name, call->arg_count);
+        resolve_nodes(program, call->args, call->arg_count);
+        break;
+    }
+
+    case AST_Node_Type_Definition: {
+        TypeDefinitionNode* type_def = (TypeDefinitionNode*)node;
+        declare(program, lookup_symbol(type_def->scope, interned_names()->self, SYMBOL_TYPE_FIELD, false));
+        resolve_node(program, (ASTNode*)type_def->body);
+        resolve_nodes(program, type_def->parent_args, type_def->parent_arg_count);
+        break;
+    }
+
+    case AST_Node_Type_Definition_List: {
+        TypeDefinitionListNode* list = (TypeDefinitionListNode*)node;
+        for (int i = 0; i < list->count; i++)
+            resolve_node(program, (ASTNode*)list->definitions[i]);
+        break;
+    }
+
+    case AST_Node_New: {
+        NewNode* new_node = (NewNode*)node;
+        resolve_nodes(program, new_node->args, new_node->arg_count);
+        break;
+    }
+
+    case AST_Node_Attribute_Access: {
+        AttributeAccessNode* access = (AttributeAccessNode*)node;
+        resolve_node(program, access->object);
+        if (access->is_method_call)
+            resolve_nodes(program, access->args, access->arg_count);
+        break;
+    }
+
+    case AST_Node_Program:
+        break;
+    }
+}
+
+void resolve_bindings(ProgramNode* program) {
+    program->slot_count = 0;
+    resolve_node(program, (ASTNode*)program->type_definitions);
+    resolve_node(program, (ASTNode*)program->function_list);
+    resolve_node(program, program->root);
+}
@@ -0,0 +1,18 @@
+#ifndef RESOLVE_BINDINGS_H
+#define RESOLVE_BINDINGS_H
+
+#include "../ast/ast.h"
+
+// Pasada posterior al chequeo semantico que deja resuelto cada nombre del
+// programa: los VariableNode, ReassignNode y FunctionCallNode guardan en
+// 'binding' el Symbol al que se refieren, y cada simbolo que tiene un valor en
+// codegen (variables de let, parametros, 'self' y funciones del programa)
+// recibe un slot distinto en [0, program->slot_count). Asi codegen llega al
+// valor de una variable indexando un arreglo, sin buscar el nombre por scopes.
+//
+// Una variable de let solo es visible despues de su declaracion
+// (let x = x + 1 ve la x de afuera), igual que durante semantic_visit.
+// Solo debe correrse una vez por AST y sobre un programa sin errores.
+void resolve_bindings(ProgramNode* program);
+
+#endif // RESOLVE_BINDINGS_H
@@ -4,37 +4,47 @@
 #include "../hulk_type/type_table.h"
 #include <stdarg.h>
 
-int semantic_error_count = 0;
+// Imprime "<prefijo> line N: <texto de la linea>" reconstruyendo la linea desde la fuente
+static void print_source_line(SemanticVisitor* visitor, const char* prefix, ASTNode* node) {
+    size_t length = 0;
+    SourceLoc loc = context_node_loc(visitor->context, node->id);
+    const char* text = visitor->context ? source_file_line(&visitor->context->source, loc.line, &length) : NULL;
+    if (text)
+        fprintf(stderr, "%s line %u: %.*s\n", prefix, loc.line, (int)length, text);
+    else
+        fprintf(stderr, "%s line %u: (no source)\n", prefix, loc.line);
+}
 
-void report_semantic_error(ASTNode* node, const char* fmt, ...) {
+void report_semantic_error(SemanticVisitor* visitor, ASTNode* node, const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    fprintf(stderr, "Semantic error at line %d: ", node->line);
-    if (node->line_text)
-        fprintf(stderr, "    %s\n", node->line_text);
+    print_source_line(visitor, "Semantic error at", node);
     vfprintf(stderr, fmt, args);
     fprintf(stderr, "\n");
     va_end(args);
-    semantic_error_count++;
+    visitor->error_count++;
 }
 
 // Imprime el backtrace simple cuando una subexpresión retorna _Error
-static void print_backtrace(ASTNode* node) {
-    fprintf(stderr, "Backtrace to line %d: %s\n", node->line, node->line_text ? node->line_text : "(no source)");
+static void print_backtrace(SemanticVisitor* visitor, ASTNode* node) {
+    print_source_line(visitor, "Backtrace to", node);
 }
 
-SemanticVisitor* init_semantic_visitor(TypeTable* type_table) {
+SemanticVisitor* init_semantic_visitor(TypeTable* type_table, const CompilationContext* context) {
     SemanticVisitor* visitor = malloc(sizeof(SemanticVisitor));
     visitor->typeTable = type_table;
+    visitor->builtins = &type_table->builtins;
+    visitor->context = context;
+    visitor->error_count = 0;
     return visitor;
 }
 
 TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTable* current_scope) {
     if (!node) {
-        return type_table_lookup(visitor->typeTable, "Null");
+        return visitor->builtins->null;
     }
 
-    TypeDescriptor* error_type = type_table_lookup(visitor->typeTable, "_Error");
+    TypeDescriptor* error_type = visitor->builtins->error;
 
     switch (node->type) {
     case AST_Node_Literal:
@@ -44,10 +54,10 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         UnaryOperationNode* unary_node = (UnaryOperationNode*) node;
         TypeDescriptor* operand_type = semantic_visit(visitor, unary_node->operand, current_scope);
         if (operand_type == error_type) {
-            print_backtrace(node);
+            print_backtrace(visitor, node);
             return error_type;
         }
-        return check_semantic_unary_operation_node(unary_node, visitor->typeTable);
+        return check_semantic_unary_operation_node(unary_node, visitor);
     }
 
     case AST_Node_Binary_Operation: {
@@ -56,10 +66,10 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         TypeDescriptor* right_type = semantic_visit(visitor, binary_node->right, current_scope);
         
         if (left_type == error_type || right_type == error_type) {
-            print_backtrace(node);
+            print_backtrace(visitor, node);
             return error_type;
         }
-        return check_semantic_binary_operation_node(binary_node, visitor->typeTable);
+        return check_semantic_binary_operation_node(binary_node, visitor);
     }
 
     case AST_Node_Expression_Block: {
@@ -67,7 +77,7 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         for (int i = 0; i < block_node->expression_count; i++) {
             semantic_visit(visitor, block_node->expressions[i], current_scope);
         }
-        return check_semantic_expression_block_node(block_node, visitor->typeTable);
+        return check_semantic_expression_block_node(block_node, visitor);
     }
 
     case AST_Node_Conditional: {
@@ -80,10 +90,10 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
 
         // Si alguna rama tiene error, imprime el backtrace pero chequea igual para propagar el tipo error
         if (cond_type == error_type || then_type == error_type || (conditional_node->else_branch && else_type == error_type)) {
-            print_backtrace(node);
+            print_backtrace(visitor, node);
             return error_type;
         }
-        return check_semantic_conditional_node(conditional_node, visitor->typeTable);
+        return check_semantic_conditional_node(conditional_node, visitor);
     }
 
     case AST_Node_While_Loop: {
@@ -92,10 +102,10 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         // Analiza el cuerpo siempre, aunque la condición tenga error
         TypeDescriptor* body_type = semantic_visit(visitor, while_node->body, current_scope);
         if (cond_type == error_type) {
-            print_backtrace(node);
+            print_backtrace(visitor, node);
             return error_type;
         }
-        return check_semantic_while_loop_node(while_node, visitor->typeTable);
+        return check_semantic_while_loop_node(while_node, visitor);
     }
 
     case AST_Node_Let_In: {
@@ -110,27 +120,27 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         }
 
         semantic_visit(visitor, let_in_node->body, let_in_node->scope);
-        return check_semantic_let_in_node(let_in_node, visitor->typeTable);
+        return check_semantic_let_in_node(let_in_node);
     }
 
     case AST_Node_Variable_Assigment: {
         VariableAssigmentNode* assign_node = (VariableAssigmentNode*) node;
         assign_node->scope = current_scope;
         semantic_visit(visitor, assign_node->assigment->value, current_scope);
-        return check_semantic_variable_assigment_node(assign_node, visitor->typeTable);
+        return check_semantic_variable_assigment_node(assign_node, visitor);
     }
 
     case AST_Node_Variable: {
         VariableNode* variable_node = (VariableNode*) node;
         variable_node->scope = current_scope;
-        return check_semantic_variable_node(variable_node, visitor->typeTable);
+        return check_semantic_variable_node(variable_node, visitor);
     }
 
     case AST_Node_Reassign: {
         ReassignNode* reassign_node = (ReassignNode*) node;
         reassign_node->scope = current_scope;
         semantic_visit(visitor, reassign_node->value, current_scope);
-        return check_semantic_reassign_node(reassign_node, visitor->typeTable);
+        return check_semantic_reassign_node(reassign_node, visitor);
     }
 
     case AST_Node_Function_Definition_List: {
@@ -139,7 +149,7 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
             FunctionDefinitionNode* function_node = function_list_node->functions[i];
             semantic_visit(visitor, (ASTNode*) function_node, current_scope);
         }
-        return type_table_lookup(visitor->typeTable, "Null");
+        return visitor->builtins->null;
     }
 
     case AST_Node_Function_Definition: {
@@ -147,11 +157,11 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         TypeDescriptor* body_type = semantic_visit(visitor, function_node->body, function_node->scope);
         if(body_type == error_type)
         {
-            print_backtrace(node);
+            print_backtrace(visitor, node);
             return error_type;
         }
-        check_semantic_function_definition_node(function_node, visitor->typeTable);
-        return type_table_lookup(visitor->typeTable, "Null");
+        check_semantic_function_definition_node(function_node, visitor);
+        return visitor->builtins->null;
     }
 
     case AST_Node_Function_Call: {
@@ -160,7 +170,7 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         for (int i = 0; i < func_call->arg_count; i++) {
             semantic_visit(visitor, func_call->args[i], current_scope);
         }
-        return check_semantic_function_call_node(func_call, current_scope, visitor->typeTable);
+        return check_semantic_function_call_node(func_call, current_scope, visitor);
     }
 
     case AST_Node_Type_Definition: {
@@ -176,7 +186,7 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
                 if(assing_type == error_type)
                 {
                     has_error = true;
-                    print_backtrace(node);
+                    print_backtrace(visitor, node);
                 }
             }
         }
@@ -186,7 +196,7 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
 
         // Add the self field
         TypeDescriptor* descriptor = type_table_lookup(visitor->typeTable, type_node->type_name);
-        Symbol* self_symbol = create_symbol("self", SYMBOL_TYPE_FIELD, descriptor, NULL);
+        Symbol* self_symbol = create_symbol(interned_names()->self, SYMBOL_TYPE_FIELD, descriptor, NULL);
         insert_symbol(type_node->scope, self_symbol);
         
         // Visit the method definitions
@@ -199,7 +209,7 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
                 if(method_type == error_type)
                 {
                     has_error = true;
-                    print_backtrace(node);
+                    print_backtrace(visitor, node);
                 }
             }
                 
@@ -211,10 +221,10 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
             if(arg_type == error_type)
             {
                 has_error = true;
-                print_backtrace(node);
+                print_backtrace(visitor, node);
             }
         }
-        return check_semantic_type_definition_node(type_node, visitor->typeTable);
+        return check_semantic_type_definition_node(type_node, visitor);
     }
 
     case AST_Node_Type_Definition_List: {
@@ -222,14 +232,14 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
         for (int i = 0; i < list_node->count; i++) {
             semantic_visit(visitor, (ASTNode*)list_node->definitions[i], current_scope);
         }
-        return type_table_lookup(visitor->typeTable, "Null");
+        return visitor->builtins->null;
     }
 
     case AST_Node_New: {
         NewNode* new_node = (NewNode*) node;
         for (int i = 0; i < new_node->arg_count; i++)
             semantic_visit(visitor, new_node->args[i], current_scope);
-        return check_semantic_new_node(new_node, visitor->typeTable);
+        return check_semantic_new_node(new_node, visitor);
     }
 
     case AST_Node_Attribute_Access: {
@@ -239,12 +249,13 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
             for (int i = 0; i < access_node->arg_count; i++)
                 semantic_visit(visitor, access_node->args[i], current_scope);
         }
-        return check_semantic_attribute_access_node(access_node, visitor->typeTable);
+        return check_semantic_attribute_access_node(access_node, visitor);
     }
 
     case AST_Node_Program: {
         ProgramNode* program_node = (ProgramNode*) node;
         register_globals(program_node, current_scope, visitor->typeTable);
+        number_type_hierarchy(visitor->typeTable);
         semantic_visit(visitor, (ASTNode*)program_node->type_definitions, current_scope);
         semantic_visit(visitor, (ASTNode*)program_node->function_list, current_scope);
         program_node->base.return_type = semantic_visit(visitor, program_node->root, current_scope);
@@ -252,6 +263,6 @@ TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTa
     }
 
     default:
-        return type_table_lookup(visitor->typeTable, "undefined");
+        return visitor->builtins->undefined;
     }
 }
\ No newline at end of file
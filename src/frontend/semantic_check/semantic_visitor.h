@@ -7,9 +7,13 @@
 
 typedef struct SemanticVisitor {
     TypeTable* typeTable;
+    const BuiltinTypes* builtins;   // Tipos builtin de typeTable, ya resueltos
+    int error_count;        // Errores semanticos reportados en esta compilacion
+    const CompilationContext* context; // Fuente y posiciones de los nodos para los errores (puede ser NULL)
 } SemanticVisitor;
 
-SemanticVisitor* init_semantic_visitor(TypeTable* type_table);
+SemanticVisitor* init_semantic_visitor(TypeTable* type_table, const CompilationContext* context);
+void report_semantic_error(SemanticVisitor* visitor, ASTNode* node, const char* fmt, ...);
 TypeDescriptor* semantic_visit(SemanticVisitor* visitor, ASTNode* node, SymbolTable* current_scope);
 void register_globals(ProgramNode* program, SymbolTable* current_scope, TypeTable* type_table);
 void register_types(TypeDefinitionListNode* list, SymbolTable* current_scope, TypeTable* type_table);
@@ -1,93 +1,60 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include "generator.h"
 #include "common/common.h"
-#include "ast/ast.h"
-#include "hulk_type/hulk_type.h"
-#include "hulk_type/type_table.h"
-#include "semantic_check/semantic_visitor.h"
-#include "scope/function.h"
+#include "options.h"
+#include "compiler.h"
+#include "server.h"
+#include "batch.h"
+#include "time_report.h"
 #include "../build/parser.tab.h"
 
 
-int main(int argc, char **argv) {
-    
-    // Declaraciones externas del parser
-    extern int yyparse();
-    extern FILE* yyin; 
-    extern ASTNode* root_node;
-    extern TypeTable* type_table;
-
-    type_table = create_type_table();
-
-    // Registrar tipos predefinidos
-    register_builtin_types(type_table);
-    printf("Se han cargado %d tipos builtin en la tabla de tipos.\n", type_table->count);
-
-    // Registrar funciones predefinidas
-    SymbolTable* global_scope = create_symbol_table(NULL);
-    register_predefined_functions(global_scope, type_table);
-    
-    // Seleccionar fuente de entrada
-    if (argc > 1) {
-        yyin = fopen(argv[1], "r");
-        if (!yyin) {
-            fprintf(stderr, "No se pudo abrir el archivo '%s'\n", argv[1]);
+// Compila un solo archivo (o un snapshot) en este proceso
+static int compile_single_input(const CompilerOptions* options) {
+    TimeReport report;
+    time_report_init(&report, options->time_report);
+
+    // Tipos builtin y funciones predefinidas
+    time_report_begin(&report, "prelude");
+    CompilerPrelude prelude;
+    load_compiler_prelude(&prelude);
+    time_report_end(&report);
+
+    int exit_code;
+    if (options->load_ast_path)
+        exit_code = compile_snapshot(options, &prelude, &report);
+    else {
+        // Seleccionar fuente de entrada (los archivos se mapean en memoria)
+        SourceBuffer source;
+        if (!source_buffer_load(&source, options->input_path)) {
+            fprintf(stderr, "No se pudo abrir el archivo '%s'\n", options->input_path ? options->input_path : "<stdin>");
+            free_compiler_prelude(&prelude);
             return 1;
         }
-    } else {
-        yyin = stdin;
-    }
-
-    // Parsear la entrada
-    int parse_result = yyparse();
-    if (parse_result != 0 || root_node == NULL) {
-        if (yyin != stdin) fclose(yyin);
-        return 1;
-    }
-    if (yyin != stdin) fclose(yyin);
 
-    if (root_node == NULL) {
-    fprintf(stderr, "El AST está vacío. No se generará código LLVM.\n");
-    return 1;
+        exit_code = compile_program(&source, options, &prelude, &report);
+        source_buffer_release(&source);
     }
-        
-    // Chequeo Semantico
-    SemanticVisitor* visitor = init_semantic_visitor(type_table);
-    semantic_visit(visitor,root_node, global_scope);
+    time_report_print(&report, stderr);
 
-    printf("Chequeo semántico completado.\n");
-    if (semantic_error_count > 0) {
-        fprintf(stderr, "Se encontraron %d errores semánticos. Compilación abortada.\n", semantic_error_count);
-        exit(EXIT_FAILURE);
-    }
-    print_ast_node(root_node, 0); // Imprimir el AST para depuración
-
-    // Generación de código LLVM
-    const char* module_name = "hulk_module";
-    LLVMCodeGenerator* generator = create_llvm_code_generator("hulk_module", type_table);
-    LLVMModuleRef module = generate_code((ProgramNode*)root_node, generator);
+    // Limpieza final
+    free_compiler_prelude(&prelude);
+    return exit_code;
+}
 
-    // Imprimir a archivo
-    if (module) {
-        char* output_filename = "output.ll";
-        char* error_message = NULL;
-       
-        if (LLVMPrintModuleToFile(module, output_filename, &error_message) != 0) {
-            fprintf(stderr, "Error al escribir el modulo LLVM: %s\n", error_message);
-            LLVMDisposeMessage(error_message);
-        } else {
-            fprintf(stderr, "Archivo '%s' generado exitosamente.\n", output_filename);
-        }
-    } else {
-        fprintf(stderr, "La generacion de codigo LLVM fallo.\n");
-        destroy_llvm_code_generator(generator);
-        return 1;
-    }
-    destroy_llvm_code_generator(generator);
+int main(int argc, char **argv) {
 
-    // Limpieza final
-    free_ast_node(root_node);
-    free_type_table(type_table);
-    return 0;
-}
\ No newline at end of file
+    CompilerOptions options;
+    int exit_code;
+    if (!parse_compiler_options(argc, argv, &options))
+        exit_code = 1;
+    else if (options.server)
+        exit_code = run_compile_server(&options, argv[0]);
+    else if (options.input_count > 1)
+        exit_code = run_batch_compile(&options);
+    else
+        exit_code = compile_single_input(&options);
+
+    free_compiler_options(&options);
+    return exit_code;
+}